@@ -0,0 +1,401 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "mbed.h"
+#include "bench.h"
+#include "demo_screens.h"
+#include "layout_cache.h"
+#include "canvas_draw.h"
+#include "label_cache.h"
+#include "sprite_layer.h"
+#include "panel.h"
+
+typedef void (*flush_cb_t)(lv_disp_drv_t *, const lv_area_t *, lv_color_t *);
+
+struct BenchScreen {
+    const char *name;
+    lv_obj_t *(*create)(lv_obj_t *parent);
+};
+
+struct FlushStats {
+    uint32_t flushes;
+    uint32_t spi_bytes;
+    uint32_t window_bytes;
+    uint32_t window_saved;
+    uint32_t crc;
+    std::chrono::microseconds flush_time;
+    std::chrono::microseconds crc_time;
+};
+
+static const BenchScreen screens[] = {
+    {"crosses", create_crosses_screen},
+#if SIXTRON_LOGO_RGB565
+    {"logo", create_rgb565_logo_screen},
+#endif
+    {"palette_logo", create_palette_logo_screen},
+    {"widgets", create_widgets_screen},
+    {"chart", create_chart_screen},
+    {"text", create_text_screen},
+    {"gradient", create_gradient_screen},
+    {"dither", create_dither_screen},
+    {"dashboard", create_dashboard_screen},
+    {"panel", create_panel_screen},
+    {"layer", create_layer_screen},
+};
+
+static FlushStats stats;
+static Timer timer;
+static MbedCRC<POLY_32BIT_ANSI, 32> crc32;
+static flush_cb_t target_flush;
+
+static void bench_flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
+{
+    uint32_t size = lv_area_get_size(area);
+
+    /* The CRC is timed apart, to be left out of the render time too */
+    std::chrono::microseconds start = timer.elapsed_time();
+    crc32.compute_partial(area, sizeof(*area), &stats.crc);
+    crc32.compute_partial(color_p, size * sizeof(lv_color_t), &stats.crc);
+    stats.flushes++;
+    stats.crc_time += timer.elapsed_time() - start;
+
+    /* Panel::flush_cb() only queues the area. Wait for it to be sent here,
+     * or LVGL waits for it before the next flush, in the render time */
+    start = timer.elapsed_time();
+    target_flush(drv, area, color_p);
+    while (drv->draw_buf->flushing) {
+        ThisThread::yield();
+    }
+    stats.flush_time += timer.elapsed_time() - start;
+}
+
+static void wait_flush(lv_disp_t *disp)
+{
+    while (lv_disp_get_draw_buf(disp)->flushing) {
+        ThisThread::yield();
+    }
+}
+
+static void bench_screen(lv_disp_t *disp, const BenchScreen &screen)
+{
+    Panel *panel = static_cast<Panel *>(disp->driver->user_data);
+    PanelIO *io = panel->io();
+    lv_obj_t *previous = lv_disp_get_scr_act(disp);
+    lv_obj_t *scr = lv_obj_create(NULL);
+    screen.create(scr);
+    lv_disp_load_scr(scr);
+
+    FlushStats best = {};
+    FlushStats first = {};
+    std::chrono::microseconds best_render = std::chrono::microseconds::max();
+
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        stats = {};
+        crc32.compute_partial_start(&stats.crc);
+
+        lv_obj_invalidate(scr);
+        uint32_t window_bytes = io->window_bytes();
+        uint32_t window_saved = io->saved_window_bytes();
+        uint32_t bytes = panel->stats().bytes;
+        std::chrono::microseconds start = timer.elapsed_time();
+        lv_refr_now(disp);
+        std::chrono::microseconds render = timer.elapsed_time() - start - stats.flush_time
+                - stats.crc_time;
+
+        /* The windows are sent by the bus arbiter */
+        wait_flush(disp);
+        stats.window_bytes = io->window_bytes() - window_bytes;
+        stats.window_saved = io->saved_window_bytes() - window_saved;
+        /* As sent: pixel format, rows left out by the filter and windows */
+        stats.spi_bytes = panel->stats().bytes - bytes;
+
+        crc32.compute_partial_stop(&stats.crc);
+        /* The bytes sent over the previous screen: with flush-filter, the
+         * next refreshes of the same screen send nothing */
+        if (i == 0) {
+            first = stats;
+        }
+        if (render < best_render) {
+            best_render = render;
+            best = stats;
+        }
+    }
+
+    printf("{\"name\": \"%s\", \"render_us\": %lu, \"flush_us\": %lu, "
+            "\"flushes\": %lu, \"spi_bytes\": %lu, \"window_bytes\": %lu, "
+            "\"window_saved\": %lu, \"crc\": \"%08lx\"}",
+            screen.name,
+            (unsigned long)best_render.count(),
+            (unsigned long)best.flush_time.count(),
+            (unsigned long)best.flushes,
+            (unsigned long)first.spi_bytes,
+            (unsigned long)first.window_bytes,
+            (unsigned long)first.window_saved,
+            (unsigned long)best.crc);
+
+    lv_disp_load_scr(previous);
+    lv_obj_del(scr);
+}
+
+static uint32_t count_objs(lv_obj_t *obj)
+{
+    uint32_t count = 1;
+
+    for (uint32_t i = 0; i < lv_obj_get_child_cnt(obj); i++) {
+        count += count_objs(lv_obj_get_child(obj, i));
+    }
+
+    return count;
+}
+
+/* Layout time per update of label, in ns. With a cache, the label is
+ * invalidated at each update, as the application has to */
+static uint32_t layout_frames(lv_obj_t *scr, lv_obj_t *label, LayoutCache *cache)
+{
+    std::chrono::microseconds total = 0us;
+
+    for (int i = 0; i < BENCH_LAYOUT_FRAMES; i++) {
+        lv_label_set_text_fmt(label, "%d", i % 10);
+        std::chrono::microseconds start = timer.elapsed_time();
+        if (cache) {
+            cache->invalidate(label);
+        }
+        lv_obj_update_layout(scr);
+        total += timer.elapsed_time() - start;
+    }
+
+    return total.count() * 1000 / BENCH_LAYOUT_FRAMES;
+}
+
+static void bench_layout()
+{
+    static LayoutCache cache;
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_t *label = create_dashboard_screen(scr);
+
+    /* Nothing is rendered: the screen is not loaded */
+    lv_obj_update_layout(scr);
+    uint32_t uncached = layout_frames(scr, label, nullptr);
+    cache.pin(scr);
+    uint32_t cached = layout_frames(scr, label, &cache);
+    cache.clear();
+
+    printf("\"layout\": {\"widgets\": %lu, \"uncached_ns\": %lu, \"cached_ns\": %lu}",
+            (unsigned long)(count_objs(scr) - 1),
+            (unsigned long)uncached,
+            (unsigned long)cached);
+
+    lv_obj_del(scr);
+}
+
+typedef void (*draw_line_t)(lv_obj_t *, const lv_point_t[], uint32_t, const lv_draw_line_dsc_t *);
+
+/* Time per line in ns, alternating a horizontal and a vertical line, or
+ * two diagonals */
+static uint32_t line_time(lv_obj_t *canvas, draw_line_t draw, bool diagonal)
+{
+    static const lv_point_t straight[2][2] = {{{2, 16}, {30, 16}}, {{16, 2}, {16, 30}}};
+    static const lv_point_t skewed[2][2] = {{{2, 4}, {30, 28}}, {{2, 28}, {30, 4}}};
+    lv_draw_line_dsc_t line;
+    lv_draw_line_dsc_init(&line);
+    line.color = LV_COLOR_MAKE(255, 255, 255);
+    line.width = 2;
+
+    std::chrono::microseconds start = timer.elapsed_time();
+    for (int i = 0; i < BENCH_LINES; i++) {
+        draw(canvas, diagonal ? skewed[i & 1] : straight[i & 1], 2, &line);
+    }
+
+    return (timer.elapsed_time() - start).count() * 1000 / BENCH_LINES;
+}
+
+/* Time per line in ns, the same lines as line_time() drawn by one
+ * canvas_draw_batch() call */
+static uint32_t batch_time(lv_obj_t *canvas, bool diagonal)
+{
+    static const lv_point_t straight[2][2] = {{{2, 16}, {30, 16}}, {{16, 2}, {16, 30}}};
+    static const lv_point_t skewed[2][2] = {{{2, 4}, {30, 28}}, {{2, 28}, {30, 4}}};
+    static CanvasPrim prims[BENCH_LINES];
+    lv_draw_line_dsc_t line;
+    lv_draw_line_dsc_init(&line);
+    line.color = LV_COLOR_MAKE(255, 255, 255);
+    line.width = 2;
+
+    for (int i = 0; i < BENCH_LINES; i++) {
+        const lv_point_t *points = diagonal ? skewed[i & 1] : straight[i & 1];
+        prims[i] = {CanvasPrim::LINE, points[0], points[1]};
+    }
+
+    std::chrono::microseconds start = timer.elapsed_time();
+    canvas_draw_batch(canvas, prims, BENCH_LINES, &line);
+
+    return (timer.elapsed_time() - start).count() * 1000 / BENCH_LINES;
+}
+
+static void bench_lines()
+{
+    static lv_color_t cbuf[LV_CANVAS_BUF_SIZE_TRUE_COLOR(32, 32)];
+    lv_obj_t *scr = lv_obj_create(NULL);
+    lv_obj_t *canvas = lv_canvas_create(scr);
+    lv_canvas_set_buffer(canvas, cbuf, 32, 32, LV_IMG_CF_TRUE_COLOR);
+
+    uint32_t canvas_ns = line_time(canvas, lv_canvas_draw_line, false);
+    uint32_t fast_ns = line_time(canvas, canvas_draw_line, false);
+    uint32_t diagonal_ns = line_time(canvas, canvas_draw_line, true);
+    uint32_t batch_ns = batch_time(canvas, false);
+    uint32_t batch_diagonal_ns = batch_time(canvas, true);
+
+    printf("\"lines\": {\"canvas_ns\": %lu, \"fast_ns\": %lu, \"diagonal_ns\": %lu, "
+            "\"batch_ns\": %lu, \"batch_diagonal_ns\": %lu}",
+            (unsigned long)canvas_ns,
+            (unsigned long)fast_ns,
+            (unsigned long)diagonal_ns,
+            (unsigned long)batch_ns,
+            (unsigned long)batch_diagonal_ns);
+
+    lv_obj_del(scr);
+}
+
+/* Render time of scr when the color of its labels changes, in us */
+static uint32_t label_time(lv_disp_t *disp, lv_obj_t *scr)
+{
+    std::chrono::microseconds best = std::chrono::microseconds::max();
+
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        lv_color_t color = i & 1 ? LV_COLOR_MAKE(255, 255, 255) : LV_COLOR_MAKE(255, 255, 0);
+        for (uint32_t j = 0; j < lv_obj_get_child_cnt(scr); j++) {
+            lv_obj_set_style_text_color(lv_obj_get_child(scr, j), color, 0);
+        }
+
+        stats = {};
+        std::chrono::microseconds start = timer.elapsed_time();
+        lv_refr_now(disp);
+        std::chrono::microseconds render = timer.elapsed_time() - start - stats.flush_time
+                - stats.crc_time;
+        if (render < best) {
+            best = render;
+        }
+    }
+
+    return best.count();
+}
+
+static void bench_labels(lv_disp_t *disp)
+{
+    lv_obj_t *previous = lv_disp_get_scr_act(disp);
+    lv_obj_t *scr = lv_obj_create(NULL);
+    create_text_screen(scr);
+    lv_disp_load_scr(scr);
+
+    uint32_t plain = label_time(disp, scr);
+    for (uint32_t i = 0; i < lv_obj_get_child_cnt(scr); i++) {
+        label_cache_attach(lv_obj_get_child(scr, i));
+    }
+    uint32_t cached = label_time(disp, scr);
+
+    printf("\"labels\": {\"labels\": %lu, \"plain_us\": %lu, \"cached_us\": %lu}",
+            (unsigned long)lv_obj_get_child_cnt(scr),
+            (unsigned long)plain,
+            (unsigned long)cached);
+
+    lv_disp_load_scr(previous);
+    lv_obj_del(scr);
+}
+
+/* A short diagonal step per move, the old and new areas overlap */
+static lv_point_t sprite_position(int move)
+{
+    return {(lv_coord_t)(4 + (move * 3) % 100), (lv_coord_t)(4 + (move * 3) % 130)};
+}
+
+static void bench_sprites(lv_disp_t *disp)
+{
+    Panel *panel = static_cast<Panel *>(disp->driver->user_data);
+    lv_coord_t width = lv_disp_get_hor_res(disp);
+    lv_coord_t height = lv_disp_get_ver_res(disp);
+    static SpriteLayer sprites(panel->io(), width, height);
+    uint16_t *frame = (uint16_t *)malloc(width * height * sizeof(uint16_t));
+
+    lv_obj_t *previous = lv_disp_get_scr_act(disp);
+    lv_obj_t *scr = lv_obj_create(NULL);
+    create_dashboard_screen(scr);
+    lv_obj_t *cross = lv_img_create(scr);
+    lv_img_set_src(cross, cross_sprite());
+    lv_disp_load_scr(scr);
+    lv_refr_now(disp);
+    wait_flush(disp);
+
+    /* LVGL renders the old and new areas with all the widgets under them */
+    stats = {};
+    std::chrono::microseconds start = timer.elapsed_time();
+    for (int i = 0; i < BENCH_SPRITE_MOVES; i++) {
+        lv_point_t pos = sprite_position(i);
+        lv_obj_set_pos(cross, pos.x, pos.y);
+        lv_refr_now(disp);
+    }
+    wait_flush(disp);
+    uint32_t lvgl_us = (timer.elapsed_time() - start - stats.crc_time).count() / BENCH_SPRITE_MOVES;
+
+    /* The same moves over the screen captured without the cross */
+    uint32_t sprite_us = 0;
+    uint32_t sprite_px = 0;
+    lv_obj_add_flag(cross, LV_OBJ_FLAG_HIDDEN);
+    if (frame && sprites.capture(disp, scr, frame) == SpriteLayer::ERROR_OK) {
+        lv_refr_now(disp);
+        wait_flush(disp);
+        lv_point_t pos = sprite_position(0);
+        int id = sprites.add(cross_sprite(), pos.x, pos.y);
+
+        start = timer.elapsed_time();
+        for (int i = 0; i < BENCH_SPRITE_MOVES; i++) {
+            pos = sprite_position(i);
+            sprite_px += sprites.move(id, pos.x, pos.y);
+        }
+        sprite_us = (timer.elapsed_time() - start).count() / BENCH_SPRITE_MOVES;
+        sprite_px /= BENCH_SPRITE_MOVES;
+        sprites.remove(id);
+    }
+
+    printf("\"sprites\": {\"moves\": %lu, \"lvgl_us\": %lu, \"sprite_us\": %lu, \"sprite_px\": %lu}",
+            (unsigned long)BENCH_SPRITE_MOVES,
+            (unsigned long)lvgl_us,
+            (unsigned long)sprite_us,
+            (unsigned long)sprite_px);
+
+    free(frame);
+    lv_disp_load_scr(previous);
+    lv_obj_del(scr);
+}
+
+void bench_run(lv_disp_t *disp)
+{
+    target_flush = disp->driver->flush_cb;
+    disp->driver->flush_cb = bench_flush;
+    timer.start();
+
+#if MBED_CONF_APP_FAST_MEM
+    printf("BENCH {\"fast_mem\": 1, \"screens\": [");
+#else
+    printf("BENCH {\"fast_mem\": 0, \"screens\": [");
+#endif
+    for (size_t i = 0; i < sizeof(screens) / sizeof(screens[0]); i++) {
+        if (i) {
+            printf(", ");
+        }
+        bench_screen(disp, screens[i]);
+    }
+    printf("], ");
+    bench_layout();
+    printf(", ");
+    bench_lines();
+    printf(", ");
+    bench_labels(disp);
+    printf(", ");
+    bench_sprites(disp);
+    printf("}\n");
+
+    timer.stop();
+    disp->driver->flush_cb = target_flush;
+}
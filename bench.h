@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "lvgl.h"
+
+/* Refreshes per screen, the fastest one is reported */
+#ifndef BENCH_ITERATIONS
+#define BENCH_ITERATIONS 5
+#endif
+
+/* Label updates timed by the layout benchmark */
+#ifndef BENCH_LAYOUT_FRAMES
+#define BENCH_LAYOUT_FRAMES 100
+#endif
+
+/* Lines drawn per case by the line benchmark */
+#ifndef BENCH_LINES
+#define BENCH_LINES 100
+#endif
+
+/* Moves of a cross timed by the sprite benchmark */
+#ifndef BENCH_SPRITE_MOVES
+#define BENCH_SPRITE_MOVES 20
+#endif
+
+/**
+ * Render the canonical demo screens on the display and print one line:
+ *
+ *     BENCH {"fast_mem": ..., "screens": [{"name": ..., "render_us": ..., "flush_us": ...,
+ *            "flushes": ..., "spi_bytes": ..., "window_bytes": ..., "window_saved": ...,
+ *            "crc": ...}, ...],
+ *            "layout": {"widgets": ..., "uncached_ns": ..., "cached_ns": ...},
+ *            "lines": {"canvas_ns": ..., "fast_ns": ..., "diagonal_ns": ...,
+ *                      "batch_ns": ..., "batch_diagonal_ns": ...},
+ *            "labels": {"labels": ..., "plain_us": ..., "cached_us": ...},
+ *            "sprites": {"moves": ..., "lvgl_us": ..., "sprite_us": ..., "sprite_px": ...}}
+ *
+ * "screens": "render_us" is the render time of each screen, without the
+ * flush and the CRC. "flush_us" runs until the flushed areas are on the
+ * panel. The bytes come from the first refresh, drawn over the previous
+ * screen: "spi_bytes" as counted by Panel::stats(), in the format of
+ * rgb444-flush and without the rows skipped by flush-filter, of which
+ * "window_bytes" are window commands; "window_saved" are the window bytes
+ * PanelIO left out as the range did not change. "crc" is the CRC-32 of the
+ * flushed areas and pixels, the snapshot of the screen.
+ *
+ * "layout": layout time per label update of the dashboard screen, without
+ * and with a LayoutCache, the label invalidated in it at each update.
+ *
+ * "lines": time per 2 px wide line on a canvas, axis-aligned through
+ * lv_canvas_draw_line() and canvas_draw_line(), and diagonal; then the same
+ * lines drawn by one canvas_draw_batch() call.
+ *
+ * "labels": render time of the text screen when its label colors change,
+ * without and with label_cache.h.
+ *
+ * "sprites": time per move of a 20x20 cross over the dashboard screen, as
+ * an LVGL image and as a sprite of sprite_layer.h, and pixels sent per
+ * sprite move.
+ *
+ * tools/bench_gate.py compares this line with a baseline.
+ */
+void bench_run(lv_disp_t *disp);
+
+#endif // BENCH_H
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdarg.h>
+#include <string.h>
+#include "mbed.h"
+#include "swo.h"
+#include "binary_log.h"
+
+MBED_STATIC_ASSERT((BINARY_LOG_RING_WORDS & (BINARY_LOG_RING_WORDS - 1)) == 0,
+        "BINARY_LOG_RING_WORDS must be a power of two");
+
+/* A record is the format address, an info word (time in ms << 8, level << 4,
+ * argument count) and the arguments */
+#define RECORD_HEADER_WORDS 2
+
+static uint32_t ring[BINARY_LOG_RING_WORDS];
+static uint32_t head;
+static uint32_t tail;
+static uint32_t dropped;
+static uint32_t reported;
+
+static sixtron::SWO swo;
+static Thread drain_thread(osPriorityLow, 1024, nullptr, "binary_log");
+
+void binary_log_write(uint32_t level, uint32_t nargs, const char *format, ...)
+{
+    uint32_t h = core_util_atomic_load_u32(&head);
+
+    if (nargs > BINARY_LOG_MAX_ARGS) {
+        nargs = BINARY_LOG_MAX_ARGS;
+    }
+    if (BINARY_LOG_RING_WORDS - (h - core_util_atomic_load_u32(&tail)) < RECORD_HEADER_WORDS + nargs) {
+        core_util_atomic_fetch_add_u32(&dropped, 1);
+        return;
+    }
+
+    uint32_t ms = Kernel::Clock::now().time_since_epoch().count();
+    ring[h++ & (BINARY_LOG_RING_WORDS - 1)] = (uint32_t)(uintptr_t)format;
+    ring[h++ & (BINARY_LOG_RING_WORDS - 1)] = (ms << 8) | ((level & 0xF) << 4) | nargs;
+
+    va_list args;
+    va_start(args, format);
+    for (uint32_t i = 0; i < nargs; i++) {
+        ring[h++ & (BINARY_LOG_RING_WORDS - 1)] = va_arg(args, uint32_t);
+    }
+    va_end(args);
+
+    core_util_atomic_store_u32(&head, h);
+}
+
+/* Sync byte, info word, format address and arguments, little-endian */
+static void write_record(uint32_t format, uint32_t info, const uint32_t *args, uint32_t nargs)
+{
+    uint8_t record[1 + (RECORD_HEADER_WORDS + BINARY_LOG_MAX_ARGS) * 4];
+    uint32_t words[RECORD_HEADER_WORDS + BINARY_LOG_MAX_ARGS];
+    uint32_t count = RECORD_HEADER_WORDS + nargs;
+
+    words[0] = info;
+    words[1] = format;
+    memcpy(&words[2], args, nargs * sizeof(uint32_t));
+
+    record[0] = BINARY_LOG_SYNC;
+    for (uint32_t i = 0; i < count; i++) {
+        record[1 + i * 4] = words[i];
+        record[2 + i * 4] = words[i] >> 8;
+        record[3 + i * 4] = words[i] >> 16;
+        record[4 + i * 4] = words[i] >> 24;
+    }
+    swo.write(record, 1 + count * 4);
+}
+
+uint32_t binary_log_drain(void)
+{
+    uint32_t t = core_util_atomic_load_u32(&tail);
+    uint32_t count = 0;
+
+    while (t != core_util_atomic_load_u32(&head)) {
+        uint32_t args[BINARY_LOG_MAX_ARGS];
+        uint32_t format = ring[t++ & (BINARY_LOG_RING_WORDS - 1)];
+        uint32_t info = ring[t++ & (BINARY_LOG_RING_WORDS - 1)];
+        uint32_t nargs = info & 0xF;
+
+        for (uint32_t i = 0; i < nargs; i++) {
+            args[i] = ring[t++ & (BINARY_LOG_RING_WORDS - 1)];
+        }
+        /* The slots are free once copied */
+        core_util_atomic_store_u32(&tail, t);
+
+        write_record(format, info, args, nargs);
+        count++;
+    }
+
+    /* Drops are a record with a null format and the count as argument */
+    uint32_t drops = core_util_atomic_load_u32(&dropped);
+    if (drops != reported) {
+        uint32_t lost = drops - reported;
+        uint32_t ms = Kernel::Clock::now().time_since_epoch().count();
+        write_record(0, (ms << 8) | 1, &lost, 1);
+        reported = drops;
+    }
+
+    return count;
+}
+
+static void drain_loop()
+{
+    while (true) {
+        binary_log_drain();
+        ThisThread::sleep_for(std::chrono::milliseconds(BINARY_LOG_DRAIN_PERIOD));
+    }
+}
+
+void binary_log_start(void)
+{
+    drain_thread.start(drain_loop);
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef BINARY_LOG_H
+#define BINARY_LOG_H
+
+/* Included by lv_conf.h: this header is also compiled as C */
+#include <stdint.h>
+
+/* Size of the log ring in 32-bit words, power of two */
+#ifndef BINARY_LOG_RING_WORDS
+#define BINARY_LOG_RING_WORDS 256
+#endif
+
+/* Period of the drain thread, in ms */
+#ifndef BINARY_LOG_DRAIN_PERIOD
+#define BINARY_LOG_DRAIN_PERIOD 50
+#endif
+
+/* Most arguments kept per message */
+#define BINARY_LOG_MAX_ARGS 6
+
+/* First byte of each record on the SWO */
+#define BINARY_LOG_SYNC 0xA5
+
+/* Number of arguments of a macro call, the format included */
+#define BINARY_LOG_NARGS(...) BINARY_LOG_NARGS_(__VA_ARGS__, 7, 6, 5, 4, 3, 2, 1, 0)
+#define BINARY_LOG_NARGS_(_1, _2, _3, _4, _5, _6, _7, n, ...) n
+
+/**
+ * Log a message without formatting it.
+ *
+ * Only the address of the format string, which is its ID in the ELF, and the
+ * raw arguments are copied to a RAM ring. The arguments must be 32-bit
+ * (integers, characters, pointers): %s strings are looked up in the ELF by
+ * tools/binlog_decode.py, which rebuilds the text.
+ */
+#define BINARY_LOG(level, ...) \
+    binary_log_write((level), BINARY_LOG_NARGS(__VA_ARGS__) - 1, __VA_ARGS__)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Single producer: log from the LVGL thread only. A full ring drops the
+ * message, the drops are reported by the next drain */
+void binary_log_write(uint32_t level, uint32_t nargs, const char *format, ...);
+
+/* Write the logged records to the SWO, returns how many were written */
+uint32_t binary_log_drain(void);
+
+/* Drain the ring from a low priority thread, which only runs when the
+ * application is idle */
+void binary_log_start(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BINARY_LOG_H
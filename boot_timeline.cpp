@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "boot_timeline.h"
+
+struct BootMark {
+    const char *phase;
+    uint32_t ms;
+};
+
+static BootMark marks[BOOT_TIMELINE_MAX_MARKS];
+static uint32_t mark_count;
+
+void boot_mark(const char *phase)
+{
+    uint32_t ms = Kernel::Clock::now().time_since_epoch().count();
+    uint32_t i = core_util_atomic_fetch_add_u32(&mark_count, 1);
+
+    if (i < BOOT_TIMELINE_MAX_MARKS) {
+        marks[i].ms = ms;
+        marks[i].phase = phase;
+    }
+}
+
+void boot_splash(PanelIO *panel, uint16_t width, uint16_t height, uint16_t *line, uint16_t color)
+{
+    for (uint16_t x = 0; x < width; x++) {
+        line[x] = color;
+    }
+
+    panel->lock();
+    panel->set_window(0, 0, width - 1, height - 1);
+    for (uint16_t y = 0; y < height; y++) {
+        panel->write_pixels(line, width);
+    }
+    panel->unlock();
+}
+
+static long find_mark(const char *phase, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++) {
+        if (marks[i].phase && strcmp(marks[i].phase, phase) == 0) {
+            return marks[i].ms;
+        }
+    }
+
+    return -1;
+}
+
+void boot_report()
+{
+    uint32_t count = core_util_atomic_load_u32(&mark_count);
+    if (count > BOOT_TIMELINE_MAX_MARKS) {
+        count = BOOT_TIMELINE_MAX_MARKS;
+    }
+
+    printf("BOOT {\"phases\": [");
+    for (uint32_t i = 0; i < count; i++) {
+        printf("%s{\"name\": \"%s\", \"ms\": %lu}", i ? ", " : "",
+                marks[i].phase ? marks[i].phase : "?", (unsigned long)marks[i].ms);
+    }
+    printf("], \"first_pixel_ms\": %ld, \"first_frame_ms\": %ld}\n",
+            find_mark(BOOT_FIRST_PIXEL, count), find_mark(BOOT_FIRST_FRAME, count));
+}
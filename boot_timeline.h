@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef BOOT_TIMELINE_H
+#define BOOT_TIMELINE_H
+
+#include "mbed.h"
+#include "panel_io.h"
+
+/* Boot phases kept for the report, the later ones are dropped */
+#ifndef BOOT_TIMELINE_MAX_MARKS
+#define BOOT_TIMELINE_MAX_MARKS 16
+#endif
+
+/* Phases reported on their own by boot_report() */
+#define BOOT_FIRST_PIXEL "first_pixel"
+#define BOOT_FIRST_FRAME "first_frame"
+
+/* Record the end of a boot phase, in ms since the kernel start. Can be called
+ * from any thread, the name must be a literal */
+void boot_mark(const char *phase);
+
+/* Fill the panel with one color, straight through the panel bus: a splash
+ * that needs neither LVGL nor a frame buffer, line holds one row */
+void boot_splash(PanelIO *panel, uint16_t width, uint16_t height, uint16_t *line, uint16_t color);
+
+/**
+ * Print the boot phases in one line:
+ *
+ *     BOOT {"phases": [{"name": ..., "ms": ...}, ...],
+ *           "first_pixel_ms": ..., "first_frame_ms": ...}
+ *
+ * "first_pixel_ms" is the time to the first visible pixel (the splash) and
+ * "first_frame_ms" the time to the first full LVGL frame on the panel, -1 if
+ * not marked.
+ */
+void boot_report();
+
+#endif // BOOT_TIMELINE_H
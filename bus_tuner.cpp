@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "bus_tuner.h"
+#include "kvstore_global_api.h"
+
+#define TUNING_MAGIC 0x42545531 /* "BTU1" */
+
+/* Clocks tried in order, the SPI driver rounds them down to its prescalers */
+static const int frequencies[] = {
+    4000000, 8000000, 12000000, 16000000, 20000000, 24000000, 32000000, 40000000, 48000000,
+};
+
+/* Transfer sizes tried, in pixels. 0 sends each flush in one transfer */
+static const uint32_t chunks[] = {0, 64, 128, 256, 512, 1024, 2048};
+
+BusTuner::BusTuner(PanelIO *panel, uint16_t width, uint16_t height):
+    _panel(panel), _width(width), _height(height)
+{
+    _tuning.magic = TUNING_MAGIC;
+    _tuning.frequency = BUS_TUNER_SAFE_FREQUENCY;
+    _tuning.chunk = PANEL_IO_CHUNK_PIXELS;
+}
+
+int BusTuner::init(uint16_t *scratch, uint32_t scratch_pixels)
+{
+    Tuning stored;
+    size_t size = 0;
+
+    if (kv_get(BUS_TUNER_KEY, &stored, sizeof(stored), &size) == MBED_SUCCESS
+            && size == sizeof(stored) && stored.magic == TUNING_MAGIC
+            && read_reference() && verify(stored.frequency)) {
+        _tuning = stored;
+        apply();
+        return ERROR_OK;
+    }
+
+    return tune(scratch, scratch_pixels);
+}
+
+int BusTuner::tune(uint16_t *scratch, uint32_t scratch_pixels)
+{
+    int err = ERROR_OK;
+
+    _tuning.frequency = BUS_TUNER_SAFE_FREQUENCY;
+    if (read_reference()) {
+        for (size_t i = 0; i < sizeof(frequencies) / sizeof(frequencies[0]); i++) {
+            if (frequencies[i] > BUS_TUNER_MAX_FREQUENCY || !verify(frequencies[i])) {
+                break;
+            }
+            _tuning.frequency = frequencies[i];
+        }
+    } else {
+        /* Nothing to compare with (MISO not wired...): stay at the safe clock */
+        err = ERROR_NO_READBACK;
+    }
+    _panel->set_frequency(_tuning.frequency);
+
+    /* Fastest transfer size, the first one on a tie. Sizes from the flush
+     * size up are the same as one transfer per flush */
+    std::chrono::microseconds best = std::chrono::microseconds::max();
+    for (size_t i = 0; i < sizeof(chunks) / sizeof(chunks[0]) && chunks[i] < scratch_pixels; i++) {
+        std::chrono::microseconds t = time_frame(scratch, scratch_pixels, chunks[i]);
+        if (t < best) {
+            best = t;
+            _tuning.chunk = chunks[i];
+        }
+    }
+    apply();
+
+    if (err == ERROR_OK
+            && kv_set(BUS_TUNER_KEY, &_tuning, sizeof(_tuning), 0) != MBED_SUCCESS) {
+        err = ERROR_NOT_STORED;
+    }
+
+    return err;
+}
+
+bool BusTuner::read_reference()
+{
+    _panel->set_frequency(BUS_TUNER_SAFE_FREQUENCY);
+    _panel->read(ili9163c_cmd::RDDID, _id, sizeof(_id));
+    _panel->read(ili9163c_cmd::RDDST, _status, sizeof(_status));
+
+    /* A floating or missing MISO reads as all zeros or all ones */
+    bool zeros = true;
+    bool ones = true;
+    for (size_t i = 0; i < sizeof(_status); i++) {
+        zeros &= _status[i] == 0x00;
+        ones &= _status[i] == 0xFF;
+    }
+
+    return !zeros && !ones;
+}
+
+bool BusTuner::verify(int frequency)
+{
+    uint8_t id[sizeof(_id)];
+    uint8_t status[sizeof(_status)];
+    bool ok = true;
+
+    _panel->set_frequency(frequency);
+    for (int i = 0; i < BUS_TUNER_READS && ok; i++) {
+        _panel->read(ili9163c_cmd::RDDID, id, sizeof(id));
+        _panel->read(ili9163c_cmd::RDDST, status, sizeof(status));
+        ok = memcmp(id, _id, sizeof(id)) == 0 && memcmp(status, _status, sizeof(status)) == 0;
+    }
+
+    return ok;
+}
+
+/* A frame flushed as the Panel does: windows of the draw buffer size, sent
+ * by the asynchronous path */
+std::chrono::microseconds BusTuner::time_frame(uint16_t *scratch, uint32_t scratch_pixels, uint32_t chunk)
+{
+    uint16_t rows = scratch_pixels / _width;
+    Timer timer;
+
+    memset(scratch, 0, rows * _width * sizeof(uint16_t));
+    _panel->set_chunk_size(chunk);
+
+    _panel->lock();
+    timer.start();
+    for (uint16_t y = 0; y < _height; y += rows) {
+        uint16_t n = (_height - y) < rows ? (_height - y) : rows;
+        _panel->set_window(0, y, _width - 1, y + n - 1);
+        _panel->write_pixels_async(scratch, (uint32_t)n * _width);
+    }
+    timer.stop();
+    _panel->unlock();
+
+    return timer.elapsed_time();
+}
+
+void BusTuner::apply()
+{
+    _panel->set_frequency(_tuning.frequency);
+    _panel->set_chunk_size(_tuning.chunk);
+}
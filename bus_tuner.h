@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef BUS_TUNER_H
+#define BUS_TUNER_H
+
+#include "mbed.h"
+#include "panel_io.h"
+
+/* Clock used to read the reference answers of the panel */
+#ifndef BUS_TUNER_SAFE_FREQUENCY
+#define BUS_TUNER_SAFE_FREQUENCY 1000000
+#endif
+
+/* Highest clock tried */
+#ifndef BUS_TUNER_MAX_FREQUENCY
+#define BUS_TUNER_MAX_FREQUENCY 48000000
+#endif
+
+/* Reads that must all match the reference for a clock to be kept */
+#ifndef BUS_TUNER_READS
+#define BUS_TUNER_READS 16
+#endif
+
+/* Key of the tuning in the global KVStore */
+#ifndef BUS_TUNER_KEY
+#define BUS_TUNER_KEY "/kv/bus_tuning"
+#endif
+
+/**
+ * SPI clock and transfer size of a panel bus, selected at runtime.
+ *
+ * The clock is raised step by step, each step being verified by reading the
+ * panel ID and status back and comparing them to the answers at a safe clock.
+ * The highest clock that passes is kept, one step below the first failure.
+ * Then a frame is flushed in draw buffer sized windows through the
+ * asynchronous path, with several transfer sizes or none, and the fastest
+ * one is kept. The result is stored in the KVStore so that the next boots only
+ * verify it.
+ */
+class BusTuner {
+public:
+    enum Error {
+        ERROR_OK = 0,
+        ERROR_NO_READBACK = -1, /* the panel does not answer, the clock is not verified */
+        ERROR_NOT_STORED = -2,  /* tuned, but the KVStore refused the result */
+    };
+
+    BusTuner(PanelIO *panel, uint16_t width, uint16_t height);
+
+    /* Apply the stored tuning if the panel still answers with it, else tune.
+     * The scratch buffer, a draw buffer, is written to the panel while the
+     * transfer sizes are timed: the panel content is lost */
+    int init(uint16_t *scratch, uint32_t scratch_pixels);
+
+    /* Tune, apply and store, regardless of the stored tuning */
+    int tune(uint16_t *scratch, uint32_t scratch_pixels);
+
+    int frequency() const
+    {
+        return _tuning.frequency;
+    }
+
+    uint32_t chunk_size() const
+    {
+        return _tuning.chunk;
+    }
+
+private:
+    struct Tuning {
+        uint32_t magic;
+        int32_t frequency;
+        uint32_t chunk;
+    };
+
+    bool read_reference();
+    bool verify(int frequency);
+    std::chrono::microseconds time_frame(uint16_t *scratch, uint32_t scratch_pixels, uint32_t chunk);
+    void apply();
+
+    PanelIO *_panel;
+    uint16_t _width;
+    uint16_t _height;
+    Tuning _tuning;
+    uint8_t _id[3];
+    uint8_t _status[4];
+};
+
+#endif // BUS_TUNER_H
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "canvas_draw.h"
+
+static bool fill(lv_img_dsc_t *img, lv_area_t area, lv_color_t color)
+{
+    const lv_area_t bounds = {0, 0, (lv_coord_t)(img->header.w - 1), (lv_coord_t)(img->header.h - 1)};
+
+    if (!_lv_area_intersect(&area, &area, &bounds)) {
+        return false;
+    }
+
+    lv_color_t *row = (lv_color_t *)img->data + area.y1 * img->header.w + area.x1;
+    lv_coord_t w = lv_area_get_width(&area);
+    for (lv_coord_t y = area.y1; y <= area.y2; y++) {
+        for (lv_coord_t x = 0; x < w; x++) {
+            row[x] = color;
+        }
+        row += img->header.w;
+    }
+
+    return true;
+}
+
+/* Pixels written by the LVGL draw functions can be filled directly */
+static bool plain_fill(const lv_img_dsc_t *img, const lv_draw_line_dsc_t *dsc)
+{
+    return img->header.cf == LV_IMG_CF_TRUE_COLOR
+            && dsc->opa >= LV_OPA_MAX
+            && dsc->blend_mode == LV_BLEND_MODE_NORMAL;
+}
+
+static bool plain_line(const lv_img_dsc_t *img, const lv_draw_line_dsc_t *dsc)
+{
+    return plain_fill(img, dsc)
+            && (dsc->dash_width == 0 || dsc->dash_gap == 0)
+            && !dsc->round_start && !dsc->round_end
+            && dsc->width > 0;
+}
+
+/* Area of an axis-aligned segment, width split as in lv_draw_line(). False
+ * for other segments */
+static bool straight_area(const lv_point_t *p1, const lv_point_t *p2, lv_coord_t width,
+        lv_area_t *area)
+{
+    int32_t w = width - 1;
+    int32_t w_half0 = w >> 1;
+    int32_t w_half1 = w_half0 + (w & 0x1);
+
+    if (p1->y == p2->y) {
+        area->x1 = LV_MIN(p1->x, p2->x);
+        area->x2 = LV_MAX(p1->x, p2->x) - 1;
+        area->y1 = p1->y - w_half1;
+        area->y2 = p1->y + w_half0;
+    } else if (p1->x == p2->x) {
+        area->x1 = p1->x - w_half1;
+        area->x2 = p1->x + w_half0;
+        area->y1 = LV_MIN(p1->y, p2->y);
+        area->y2 = LV_MAX(p1->y, p2->y) - 1;
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+void canvas_draw_line(lv_obj_t *canvas, const lv_point_t points[], uint32_t point_cnt,
+        const lv_draw_line_dsc_t *dsc)
+{
+    lv_img_dsc_t *img = lv_canvas_get_img(canvas);
+    bool plain = plain_line(img, dsc);
+    bool filled = false;
+
+    for (uint32_t i = 0; i + 1 < point_cnt; i++) {
+        lv_area_t area;
+
+        if (!plain || !straight_area(&points[i], &points[i + 1], dsc->width, &area)) {
+            lv_canvas_draw_line(canvas, &points[i], 2, dsc);
+            continue;
+        }
+
+        filled |= fill(img, area, dsc->color);
+    }
+
+    if (filled) {
+        lv_obj_invalidate(canvas);
+    }
+}
+
+/* Area covered by a primitive, lines with their width and anti-aliasing */
+static lv_area_t prim_area(const CanvasPrim &prim, lv_coord_t width)
+{
+    int32_t w = width - 1;
+    int32_t w_half0 = w >> 1;
+    int32_t w_half1 = w_half0 + (w & 0x1);
+    lv_area_t area;
+
+    if (prim.kind == CanvasPrim::POINT) {
+        lv_area_set(&area, prim.p1.x - w_half1, prim.p1.y - w_half1,
+                prim.p1.x + w_half0, prim.p1.y + w_half0);
+        return area;
+    }
+
+    lv_area_set(&area, LV_MIN(prim.p1.x, prim.p2.x), LV_MIN(prim.p1.y, prim.p2.y),
+            LV_MAX(prim.p1.x, prim.p2.x), LV_MAX(prim.p1.y, prim.p2.y));
+    if (prim.kind == CanvasPrim::LINE) {
+        area.x1 -= w_half1 + 1;
+        area.y1 -= w_half1 + 1;
+        area.x2 += w_half0 + 1;
+        area.y2 += w_half0 + 1;
+    }
+
+    return area;
+}
+
+void canvas_draw_batch(lv_obj_t *canvas, const CanvasPrim prims[], uint32_t count,
+        const lv_draw_line_dsc_t *dsc)
+{
+    lv_img_dsc_t *img = lv_canvas_get_img(canvas);
+    lv_draw_rect_dsc_t rect;
+    lv_draw_rect_dsc_init(&rect);
+    rect.bg_color = dsc->color;
+    rect.bg_opa = dsc->opa;
+    rect.blend_mode = dsc->blend_mode;
+
+    if (img->header.cf != LV_IMG_CF_TRUE_COLOR) {
+        for (uint32_t i = 0; i < count; i++) {
+            if (prims[i].kind == CanvasPrim::LINE) {
+                lv_canvas_draw_line(canvas, &prims[i].p1, 2, dsc);
+            } else {
+                lv_area_t area = prim_area(prims[i], dsc->width);
+                lv_canvas_draw_rect(canvas, area.x1, area.y1, lv_area_get_width(&area),
+                        lv_area_get_height(&area), &rect);
+            }
+        }
+        return;
+    }
+
+    /* The draw functions render into the buffer of the display being
+     * refreshed: a copy of the display with the canvas as buffer, as
+     * lv_canvas_draw_line() does, but once for the batch */
+    const lv_area_t bounds = {0, 0, (lv_coord_t)(img->header.w - 1), (lv_coord_t)(img->header.h - 1)};
+    lv_disp_t *disp = lv_obj_get_disp(canvas);
+    lv_disp_drv_t driver = *disp->driver;
+    lv_disp_draw_buf_t draw_buf = *driver.draw_buf;
+    lv_disp_t canvas_disp = *disp;
+    draw_buf.buf_act = (void *)img->data;
+    draw_buf.area = bounds;
+    driver.draw_buf = &draw_buf;
+    driver.set_px_cb = nullptr;
+    canvas_disp.driver = &driver;
+
+    lv_disp_t *refreshing = _lv_refr_get_disp_refreshing();
+    _lv_refr_set_disp_refreshing(&canvas_disp);
+
+    bool fill_line = plain_line(img, dsc);
+    bool fill_area = plain_fill(img, dsc);
+    lv_area_t dirty = {};
+    bool drawn = false;
+
+    for (uint32_t i = 0; i < count; i++) {
+        const CanvasPrim &prim = prims[i];
+        lv_area_t area = prim_area(prim, dsc->width);
+
+        if (prim.kind == CanvasPrim::LINE) {
+            lv_area_t straight;
+            if (fill_line && straight_area(&prim.p1, &prim.p2, dsc->width, &straight)) {
+                fill(img, straight, dsc->color);
+            } else {
+                lv_draw_line(&prim.p1, &prim.p2, &bounds, dsc);
+            }
+        } else if (fill_area) {
+            fill(img, area, dsc->color);
+        } else {
+            lv_draw_rect(&area, &bounds, &rect);
+        }
+
+        if (drawn) {
+            _lv_area_join(&dirty, &dirty, &area);
+        } else {
+            dirty = area;
+            drawn = true;
+        }
+    }
+
+    _lv_refr_set_disp_refreshing(refreshing);
+
+    if (drawn && _lv_area_intersect(&dirty, &dirty, &bounds)) {
+        lv_area_t coords;
+        lv_obj_get_coords(canvas, &coords);
+        lv_area_move(&dirty, coords.x1, coords.y1);
+        lv_obj_invalidate_area(canvas, &dirty);
+    }
+}
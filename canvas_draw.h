@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef CANVAS_DRAW_H
+#define CANVAS_DRAW_H
+
+#include "lvgl.h"
+
+/**
+ * Same as lv_canvas_draw_line(), with a fast path for axis-aligned segments.
+ *
+ * Horizontal and vertical segments of an opaque, plain line (no dash, no
+ * round ends) are filled directly in the canvas buffer, with the geometry
+ * of the LVGL line renderer: the pixels are the same. This skips the
+ * temporary display that lv_canvas_draw_line() sets up for each call.
+ * Other segments go through lv_canvas_draw_line().
+ */
+void canvas_draw_line(lv_obj_t *canvas, const lv_point_t points[], uint32_t point_cnt,
+        const lv_draw_line_dsc_t *dsc);
+
+/* One primitive of canvas_draw_batch(), in canvas coordinates */
+struct CanvasPrim {
+    enum Kind : uint8_t {
+        LINE,  /* from p1 to p2 */
+        POINT, /* square of the line width at p1, p2 is unused */
+        RECT,  /* filled, p1 and p2 are opposite corners, included */
+    } kind;
+    lv_point_t p1;
+    lv_point_t p2;
+};
+
+/**
+ * Draw lines, points and rectangles sharing one line descriptor on a
+ * canvas, then invalidate the bounding box of all of them at once.
+ *
+ * Opaque points and rectangles, and the lines canvas_draw_line() fills
+ * directly, are written to the canvas buffer. The others are drawn by the
+ * LVGL draw functions, with the canvas set up once as the draw buffer for
+ * the whole batch instead of once per lv_canvas_draw_line() call. Points
+ * and rectangles take the color, opacity and blend mode of dsc.
+ *
+ * Canvases that are not LV_IMG_CF_TRUE_COLOR are drawn one primitive at a
+ * time through lv_canvas_draw_line() and lv_canvas_draw_rect().
+ */
+void canvas_draw_batch(lv_obj_t *canvas, const CanvasPrim prims[], uint32_t count,
+        const lv_draw_line_dsc_t *dsc);
+
+#endif // CANVAS_DRAW_H
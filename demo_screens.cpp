@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "demo_screens.h"
+#include "dither_gradient.h"
+#include "canvas_draw.h"
+#include "layer_cache.h"
+#include "palette_image.h"
+#include "sixtron-logo-indexed.h"
+
+/* Close colors: the 16-bit gradient shows wide bands */
+#define GRADIENT_TOP 0x1E3C72
+#define GRADIENT_BOTTOM 0x2A5298
+
+#if SIXTRON_LOGO_RGB565
+#include "sixtron-logo1.h"
+
+#define LOGO_WIDTH 118
+#define LOGO_HEIGHT 150
+
+const lv_img_dsc_t sixtron_logo = {
+    .header = {
+        .cf = LV_IMG_CF_TRUE_COLOR,
+        .always_zero = 0,
+        .reserved = 0,
+        .w = LOGO_WIDTH,
+        .h = LOGO_HEIGHT,
+    },
+    .data_size = LOGO_WIDTH * LOGO_HEIGHT * sizeof(uint16_t),
+    .data = (const uint8_t *)image,
+};
+#endif
+
+/* Same logo quantized to 16 colors, a quarter of the flash */
+static const lv_img_dsc_t sixtron_logo_indexed = {
+    .header = {
+        .cf = LOGO_INDEXED_CF,
+        .always_zero = 0,
+        .reserved = 0,
+        .w = LOGO_INDEXED_WIDTH,
+        .h = LOGO_INDEXED_HEIGHT,
+    },
+    .data_size = sizeof(logo_indexed_data),
+    .data = logo_indexed_data,
+};
+
+void draw_cross(lv_obj_t *canvas, uint8_t x, uint8_t y)
+{
+    uint8_t w = 20;
+    uint8_t h = 20;
+
+    const CanvasPrim cross[] = {
+        {CanvasPrim::LINE, {x, (lv_coord_t)(y - h / 2)}, {x, (lv_coord_t)(y + h / 2)}},
+        {CanvasPrim::LINE, {(lv_coord_t)(x - w / 2), y}, {(lv_coord_t)(x + w / 2), y}},
+    };
+    lv_draw_line_dsc_t line;
+    lv_draw_line_dsc_init(&line);
+    line.color = LV_COLOR_MAKE(255, 255, 255);
+    line.width = 2;
+
+    canvas_draw_batch(canvas, cross, 2, &line);
+}
+
+const lv_img_dsc_t *cross_sprite()
+{
+    static const uint8_t size = 20;
+    static lv_color_t pixels[size * size];
+    static lv_img_dsc_t sprite;
+
+    if (!sprite.data) {
+        for (uint8_t y = 0; y < size; y++) {
+            for (uint8_t x = 0; x < size; x++) {
+                bool on = x == size / 2 - 1 || x == size / 2 || y == size / 2 - 1 || y == size / 2;
+                pixels[y * size + x] = on ? LV_COLOR_MAKE(255, 255, 255) : LV_COLOR_CHROMA_KEY;
+            }
+        }
+        sprite.header.cf = LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED;
+        sprite.header.w = size;
+        sprite.header.h = size;
+        sprite.data_size = sizeof(pixels);
+        sprite.data = (const uint8_t *)pixels;
+    }
+
+    return &sprite;
+}
+
+lv_obj_t *create_crosses_screen(lv_obj_t *parent)
+{
+    lv_coord_t width = lv_disp_get_hor_res(lv_obj_get_disp(parent));
+    lv_coord_t height = lv_disp_get_ver_res(lv_obj_get_disp(parent));
+    static lv_color_t cbuf[LV_CANVAS_BUF_SIZE_TRUE_COLOR(LV_HOR_RES_MAX, LV_VER_RES_MAX)];
+
+    lv_obj_t *canvas = lv_canvas_create(parent);
+    lv_canvas_set_buffer(canvas, cbuf, width, height, LV_IMG_CF_TRUE_COLOR);
+    lv_canvas_fill_bg(canvas, LV_COLOR_MAKE(0, 0, 0), LV_OPA_COVER);
+
+    draw_cross(canvas, 10, 10);
+
+    draw_cross(canvas, width - 10, 10);
+
+    draw_cross(canvas, 10, height - 10);
+
+    draw_cross(canvas, width - 10, height - 10);
+
+    draw_cross(canvas, width / 2, height / 2);
+
+    return canvas;
+}
+
+lv_obj_t *create_logo_screen(lv_obj_t *parent)
+{
+#ifdef SIXTRON_LOGO_SRC
+    lv_obj_t *logo = lv_img_create(parent);
+    lv_img_set_src(logo, SIXTRON_LOGO_SRC);
+#else
+    lv_obj_t *logo = palette_image_create(parent, &sixtron_logo_indexed);
+#endif
+    lv_obj_center(logo);
+
+    return logo;
+}
+
+#if SIXTRON_LOGO_RGB565
+lv_obj_t *create_rgb565_logo_screen(lv_obj_t *parent)
+{
+    lv_obj_t *logo = lv_img_create(parent);
+    lv_img_set_src(logo, &sixtron_logo);
+    lv_obj_center(logo);
+
+    return logo;
+}
+#endif
+
+lv_obj_t *create_palette_logo_screen(lv_obj_t *parent)
+{
+    lv_obj_t *logo = palette_image_create(parent, &sixtron_logo_indexed);
+    lv_obj_center(logo);
+
+    return logo;
+}
+
+lv_obj_t *create_widgets_screen(lv_obj_t *parent)
+{
+    lv_obj_t *btn = lv_btn_create(parent);
+    lv_obj_set_size(btn, 100, 30);
+    lv_obj_align(btn, LV_ALIGN_TOP_MID, 0, 6);
+    lv_obj_t *label = lv_label_create(btn);
+    lv_label_set_text(label, "Button");
+    lv_obj_center(label);
+
+    lv_obj_t *sw = lv_switch_create(parent);
+    lv_obj_align(sw, LV_ALIGN_TOP_MID, 0, 44);
+
+    lv_obj_t *slider = lv_slider_create(parent);
+    lv_obj_set_width(slider, 100);
+    lv_slider_set_value(slider, 40, LV_ANIM_OFF);
+    lv_obj_align(slider, LV_ALIGN_TOP_MID, 0, 84);
+
+    lv_obj_t *bar = lv_bar_create(parent);
+    lv_obj_set_width(bar, 100);
+    lv_bar_set_value(bar, 70, LV_ANIM_OFF);
+    lv_obj_align(bar, LV_ALIGN_TOP_MID, 0, 108);
+
+    lv_obj_t *cb = lv_checkbox_create(parent);
+    lv_checkbox_set_text(cb, "Check");
+    lv_obj_align(cb, LV_ALIGN_BOTTOM_MID, 0, -6);
+
+    return btn;
+}
+
+lv_obj_t *create_chart_screen(lv_obj_t *parent)
+{
+    lv_obj_t *chart = lv_chart_create(parent);
+    lv_obj_set_size(chart, 120, 100);
+    lv_obj_center(chart);
+    lv_chart_set_point_count(chart, 32);
+
+    lv_chart_series_t *series = lv_chart_add_series(chart, LV_COLOR_MAKE(255, 0, 0),
+            LV_CHART_AXIS_PRIMARY_Y);
+    for (int i = 0; i < 32; i++) {
+        /* Deterministic saw tooth so that the snapshot is stable */
+        lv_chart_set_next_value(chart, series, (i * 37) % 100);
+    }
+
+    return chart;
+}
+
+lv_obj_t *create_text_screen(lv_obj_t *parent)
+{
+    static const char *const texts[] = {
+        "Zest Display LCD, 128x160 ILI9163C panel driven over SPI.",
+        "LVGL renders into a 10 line draw buffer flushed stripe by stripe.",
+        "Sixtron - CATIE",
+    };
+    lv_obj_t *label = nullptr;
+    lv_coord_t y = 4;
+
+    for (const char *text : texts) {
+        label = lv_label_create(parent);
+        lv_label_set_long_mode(label, LV_LABEL_LONG_WRAP);
+        lv_obj_set_width(label, 120);
+        lv_label_set_text_static(label, text);
+        lv_obj_align(label, LV_ALIGN_TOP_MID, 0, y);
+        y += 52;
+    }
+
+    return label;
+}
+
+static lv_obj_t *create_background(lv_obj_t *parent)
+{
+    lv_obj_t *bg = lv_obj_create(parent);
+    lv_obj_set_size(bg, lv_disp_get_hor_res(lv_obj_get_disp(parent)),
+            lv_disp_get_ver_res(lv_obj_get_disp(parent)));
+    lv_obj_set_pos(bg, 0, 0);
+    lv_obj_set_style_radius(bg, 0, 0);
+    lv_obj_set_style_border_width(bg, 0, 0);
+    lv_obj_set_style_pad_all(bg, 0, 0);
+
+    lv_obj_t *label = lv_label_create(bg);
+    lv_label_set_text(label, "Gradient");
+    lv_obj_set_style_text_color(label, LV_COLOR_MAKE(255, 255, 255), 0);
+    lv_obj_center(label);
+
+    return bg;
+}
+
+lv_obj_t *create_gradient_screen(lv_obj_t *parent)
+{
+    lv_obj_t *bg = create_background(parent);
+    lv_obj_set_style_bg_color(bg, lv_color_hex(GRADIENT_TOP), 0);
+    lv_obj_set_style_bg_grad_color(bg, lv_color_hex(GRADIENT_BOTTOM), 0);
+    lv_obj_set_style_bg_grad_dir(bg, LV_GRAD_DIR_VER, 0);
+    lv_obj_set_style_bg_opa(bg, LV_OPA_COVER, 0);
+
+    return bg;
+}
+
+lv_obj_t *create_dither_screen(lv_obj_t *parent)
+{
+    lv_obj_t *bg = create_background(parent);
+    dither_gradient_attach(bg, GRADIENT_TOP, GRADIENT_BOTTOM, LV_GRAD_DIR_VER);
+
+    return bg;
+}
+
+lv_obj_t *create_dashboard_screen(lv_obj_t *parent)
+{
+    lv_obj_t *first = nullptr;
+
+    for (int row = 0; row < 10; row++) {
+        lv_obj_t *cont = lv_obj_create(parent);
+        lv_obj_set_size(cont, LV_PCT(100), LV_SIZE_CONTENT);
+        lv_obj_set_style_pad_all(cont, 0, 0);
+        lv_obj_set_style_border_width(cont, 0, 0);
+        lv_obj_set_style_radius(cont, 0, 0);
+        lv_obj_set_pos(cont, 0, row * 16);
+
+        for (int col = 0; col < 9; col++) {
+            lv_obj_t *label = lv_label_create(cont);
+            lv_label_set_text_fmt(label, "%d", (row + col) % 10);
+            lv_obj_set_pos(label, col * 14, 0);
+            if (!first) {
+                first = label;
+            }
+        }
+    }
+
+    return first;
+}
+
+lv_obj_t *create_panel_screen(lv_obj_t *parent)
+{
+    static const char *const lines[] = {"Temperature", "Humidity", "Pressure"};
+
+    create_gradient_screen(parent);
+
+    lv_obj_t *panel = lv_obj_create(parent);
+    lv_obj_set_size(panel, 108, 100);
+    lv_obj_align(panel, LV_ALIGN_CENTER, 0, 0);
+    lv_obj_set_style_bg_color(panel, LV_COLOR_MAKE(255, 255, 255), 0);
+    lv_obj_set_style_bg_opa(panel, LV_OPA_50, 0);
+    lv_obj_set_style_radius(panel, 8, 0);
+    lv_obj_clear_flag(panel, LV_OBJ_FLAG_SCROLLABLE);
+
+    for (int i = 0; i < 3; i++) {
+        lv_obj_t *label = lv_label_create(panel);
+        lv_label_set_text(label, lines[i]);
+        lv_obj_set_pos(label, 0, i * 18);
+    }
+
+    lv_obj_t *bar = lv_bar_create(panel);
+    lv_obj_set_size(bar, LV_PCT(100), 10);
+    lv_obj_align(bar, LV_ALIGN_BOTTOM_MID, 0, 0);
+    lv_bar_set_value(bar, 60, LV_ANIM_OFF);
+
+    return panel;
+}
+
+lv_obj_t *create_layer_screen(lv_obj_t *parent)
+{
+    static LayerCache layers;
+    lv_obj_t *panel = create_panel_screen(parent);
+
+    /* The layer is freed with the panel */
+    layers.cache(panel);
+
+    return panel;
+}
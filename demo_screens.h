@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef DEMO_SCREENS_H
+#define DEMO_SCREENS_H
+
+#include "lvgl.h"
+
+/* The RGB565 logo is compiled in when shown, and in the benchmark for
+ * comparison with the indexed one */
+#define SIXTRON_LOGO_RGB565 ((!MBED_CONF_APP_ASSET_FS && !MBED_CONF_APP_INDEXED_LOGO) \
+        || MBED_CONF_APP_BENCHMARK)
+
+#if SIXTRON_LOGO_RGB565
+/* Sixtron logo, 118x150 RGB565 */
+extern const lv_img_dsc_t sixtron_logo;
+#endif
+
+#if MBED_CONF_APP_ASSET_FS
+/* Sixtron logo read from the asset file system, see tools/rli_convert.py */
+#define SIXTRON_LOGO_SRC "F:logo.rli"
+#elif !MBED_CONF_APP_INDEXED_LOGO
+#define SIXTRON_LOGO_SRC (&sixtron_logo)
+#endif
+
+void draw_cross(lv_obj_t *canvas, uint8_t x, uint8_t y);
+
+/* The cross of draw_cross() as a 20x20 chroma keyed image, centered on
+ * (10, 10), for sprite_layer.h */
+const lv_img_dsc_t *cross_sprite();
+
+/* Full screen canvas with a cross in each corner and one in the middle */
+lv_obj_t *create_crosses_screen(lv_obj_t *parent);
+
+/* Sixtron logo centered on the screen: the indexed one with indexed-logo */
+lv_obj_t *create_logo_screen(lv_obj_t *parent);
+
+/* Same logo, 4-bit indexed, drawn by palette_image.h */
+lv_obj_t *create_palette_logo_screen(lv_obj_t *parent);
+
+#if SIXTRON_LOGO_RGB565
+/* Same logo, RGB565, drawn by an LVGL image */
+lv_obj_t *create_rgb565_logo_screen(lv_obj_t *parent);
+#endif
+
+/* A few widgets with the default theme styles */
+lv_obj_t *create_widgets_screen(lv_obj_t *parent);
+
+/* Line chart with one series */
+lv_obj_t *create_chart_screen(lv_obj_t *parent);
+
+/* Multi-line labels */
+lv_obj_t *create_text_screen(lv_obj_t *parent);
+
+/* Full screen dark blue vertical gradient, drawn by LVGL */
+lv_obj_t *create_gradient_screen(lv_obj_t *parent);
+
+/* Same gradient, ordered-dithered by dither_gradient.h */
+lv_obj_t *create_dither_screen(lv_obj_t *parent);
+
+/* 10 content sized rows of 9 digit labels: 100 widgets. Return the first
+ * digit label */
+lv_obj_t *create_dashboard_screen(lv_obj_t *parent);
+
+/* Semi-transparent panel of labels and a bar over the gradient. Return the
+ * panel */
+lv_obj_t *create_panel_screen(lv_obj_t *parent);
+
+/* Same panel, shown through a layer of layer_cache.h */
+lv_obj_t *create_layer_screen(lv_obj_t *parent);
+
+#endif // DEMO_SCREENS_H
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "dither_gradient.h"
+
+struct DitherGradient {
+    uint32_t from;
+    uint32_t to;
+    lv_grad_dir_t dir;
+    lv_coord_t width;
+    lv_coord_t height;
+    /* Vertical: the 4 pixel pattern of each row. Horizontal: 4 full lines */
+    lv_color_t *templates;
+};
+
+static const uint8_t bayer4[4][4] = {
+    {0, 8, 2, 10},
+    {12, 4, 14, 6},
+    {3, 11, 1, 9},
+    {15, 7, 13, 5},
+};
+
+/* Channel shift in the 0xRRGGBB colors, and in RGB565 with its width */
+static const uint8_t shifts[3][3] = {
+    {16, 11, 5},
+    {8, 5, 6},
+    {0, 0, 5},
+};
+
+/* Color at pos of length, dithered with threshold (0 to 15) */
+static lv_color_t dither(uint32_t from, uint32_t to, int32_t pos, int32_t length, uint8_t threshold)
+{
+    int32_t span = length > 1 ? length - 1 : 1;
+    uint16_t full = 0;
+
+    for (const uint8_t *shift : shifts) {
+        int32_t a = (from >> shift[0]) & 0xFF;
+        int32_t b = (to >> shift[0]) & 0xFF;
+        /* 8.8 fixed point, then threshold within one output step */
+        int32_t value = (a << 8) + ((b - a) * 256 * pos) / span;
+        uint8_t drop = 8 - shift[2] + 8;
+        int32_t out = (value + (threshold << (drop - 4))) >> drop;
+        int32_t max = (1 << shift[2]) - 1;
+        full |= (uint16_t)(LV_MIN(out, max) << shift[1]);
+    }
+
+    lv_color_t color;
+    color.full = full;
+    return color;
+}
+
+static bool build_templates(DitherGradient *grad, lv_coord_t width, lv_coord_t height)
+{
+    uint32_t count = grad->dir == LV_GRAD_DIR_HOR ? 4 * width : 4 * height;
+
+    lv_mem_free(grad->templates);
+    grad->templates = (lv_color_t *)lv_mem_alloc(count * sizeof(lv_color_t));
+    if (!grad->templates) {
+        return false;
+    }
+    grad->width = width;
+    grad->height = height;
+
+    for (lv_coord_t j = 0; j < 4; j++) {
+        if (grad->dir == LV_GRAD_DIR_HOR) {
+            for (lv_coord_t x = 0; x < width; x++) {
+                grad->templates[j * width + x] = dither(grad->from, grad->to, x, width,
+                        bayer4[j][x & 3]);
+            }
+        } else {
+            for (lv_coord_t y = 0; y < height; y++) {
+                grad->templates[y * 4 + j] = dither(grad->from, grad->to, y, height,
+                        bayer4[y & 3][j]);
+            }
+        }
+    }
+
+    return true;
+}
+
+static void draw(DitherGradient *grad, lv_obj_t *obj, const lv_area_t *clip)
+{
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    lv_coord_t width = lv_area_get_width(&coords);
+    lv_coord_t height = lv_area_get_height(&coords);
+
+    if (!grad->templates || grad->width != width || grad->height != height) {
+        if (!build_templates(grad, width, height)) {
+            return;
+        }
+    }
+
+    lv_disp_draw_buf_t *draw_buf = lv_disp_get_draw_buf(_lv_refr_get_disp_refreshing());
+    const lv_area_t *buf_area = &draw_buf->area;
+    lv_area_t area;
+    if (!_lv_area_intersect(&area, &coords, clip) || !_lv_area_intersect(&area, &area, buf_area)) {
+        return;
+    }
+
+    lv_coord_t stride = lv_area_get_width(buf_area);
+    lv_coord_t n = lv_area_get_width(&area);
+    lv_coord_t x0 = area.x1 - coords.x1;
+    lv_color_t *dst = (lv_color_t *)draw_buf->buf_act
+            + (area.y1 - buf_area->y1) * stride + (area.x1 - buf_area->x1);
+
+    for (lv_coord_t y = area.y1 - coords.y1; y <= area.y2 - coords.y1; y++) {
+        if (grad->dir == LV_GRAD_DIR_HOR) {
+            memcpy(dst, &grad->templates[(y & 3) * width + x0], n * sizeof(lv_color_t));
+        } else {
+            const lv_color_t *tile = &grad->templates[y * 4];
+            for (lv_coord_t i = 0; i < n; i++) {
+                dst[i] = tile[(x0 + i) & 3];
+            }
+        }
+        dst += stride;
+    }
+}
+
+static void event_cb(lv_event_t *e)
+{
+    DitherGradient *grad = (DitherGradient *)lv_event_get_user_data(e);
+
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_DRAW_MAIN_BEGIN:
+            /* Before the border and the children */
+            draw(grad, lv_event_get_target(e), (const lv_area_t *)lv_event_get_param(e));
+            break;
+        case LV_EVENT_DELETE:
+            lv_mem_free(grad->templates);
+            lv_mem_free(grad);
+            break;
+        default:
+            break;
+    }
+}
+
+void dither_gradient_attach(lv_obj_t *obj, uint32_t from, uint32_t to, lv_grad_dir_t dir)
+{
+    DitherGradient *grad = (DitherGradient *)lv_mem_alloc(sizeof(DitherGradient));
+    if (!grad) {
+        return;
+    }
+
+    grad->from = from;
+    grad->to = to;
+    grad->dir = dir;
+    grad->width = 0;
+    grad->height = 0;
+    grad->templates = nullptr;
+
+    lv_obj_set_style_bg_opa(obj, LV_OPA_TRANSP, 0);
+    lv_obj_add_event_cb(obj, event_cb, LV_EVENT_ALL, grad);
+}
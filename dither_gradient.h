@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef DITHER_GRADIENT_H
+#define DITHER_GRADIENT_H
+
+#include "lvgl.h"
+
+/**
+ * Draw an ordered-dithered gradient as the background of obj.
+ *
+ * The gradient is computed from 24-bit colors (0xRRGGBB) and reduced to
+ * RGB565 with a 4x4 Bayer matrix, which hides the bands of a 16-bit
+ * gradient. The dithered lines are generated once per gradient size and
+ * copied into the draw buffer on every redraw.
+ *
+ * The LVGL background of obj is made transparent and replaced, the border
+ * and the children are drawn over it as usual. The radius is ignored.
+ */
+void dither_gradient_attach(lv_obj_t *obj, uint32_t from, uint32_t to, lv_grad_dir_t dir);
+
+#endif // DITHER_GRADIENT_H
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "flush_filter.h"
+
+#define FNV_OFFSET 2166136261u
+#define FNV_PRIME 16777619u
+
+FlushFilter::FlushFilter()
+{
+    invalidate();
+}
+
+bool FlushFilter::row_changed(lv_coord_t y, lv_coord_t x1, lv_coord_t x2, const lv_color_t *row)
+{
+    if (y < 0 || y >= FLUSH_FILTER_MAX_ROWS) {
+        return true;
+    }
+
+    /* FNV-1a over pixel pairs */
+    uint32_t count = x2 - x1 + 1;
+    uint32_t hash = FNV_OFFSET;
+    uint32_t i = 0;
+    for (; i + 1 < count; i += 2) {
+        hash = (hash ^ (row[i].full | ((uint32_t)row[i + 1].full << 16))) * FNV_PRIME;
+    }
+    if (i < count) {
+        hash = (hash ^ row[i].full) * FNV_PRIME;
+    }
+
+    Row &last = _rows[y];
+    if (last.x1 == x1 && last.x2 == x2 && last.hash == hash) {
+        return false;
+    }
+
+    last.hash = hash;
+    last.x1 = x1;
+    last.x2 = x2;
+    return true;
+}
+
+void FlushFilter::invalidate(lv_coord_t y1, lv_coord_t y2)
+{
+    y1 = LV_MAX(y1, 0);
+    y2 = LV_MIN(y2, FLUSH_FILTER_MAX_ROWS - 1);
+
+    /* An empty span matches no area */
+    for (lv_coord_t y = y1; y <= y2; y++) {
+        _rows[y].hash = 0;
+        _rows[y].x1 = 1;
+        _rows[y].x2 = 0;
+    }
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef FLUSH_FILTER_H
+#define FLUSH_FILTER_H
+
+#include "mbed.h"
+#include "lvgl.h"
+
+/* Rows of the panel */
+#ifndef FLUSH_FILTER_MAX_ROWS
+#define FLUSH_FILTER_MAX_ROWS 160
+#endif
+
+/**
+ * Memory of what was last sent on each panel row, to skip unchanged rows.
+ *
+ * Each row keeps the hash and the columns of the last span flushed on it. A
+ * row of a new area is unchanged when it covers the same columns with the
+ * same hash: LVGL redraws whole widget areas, so a label going from "12.3"
+ * to "12.4" only sends the rows of the changed digit.
+ *
+ * A 32-bit hash may collide: the probability to skip a changed row is about
+ * 2^-32 per row. Rows written to the panel outside of LVGL must be
+ * invalidated: Panel::set_filter() does it for every window opened on its
+ * PanelIO outside of its flushes.
+ */
+class FlushFilter {
+public:
+    FlushFilter();
+
+    /* Return whether the row y of columns x1 to x2 differs from what was last
+     * sent there, and remember it as sent */
+    bool row_changed(lv_coord_t y, lv_coord_t x1, lv_coord_t x2, const lv_color_t *row);
+
+    /* Forget the rows y1 to y2, they are sent on their next flush */
+    void invalidate(lv_coord_t y1 = 0, lv_coord_t y2 = FLUSH_FILTER_MAX_ROWS - 1);
+
+private:
+    struct Row {
+        uint32_t hash;
+        lv_coord_t x1;
+        lv_coord_t x2;
+    };
+
+    Row _rows[FLUSH_FILTER_MAX_ROWS];
+};
+
+#endif // FLUSH_FILTER_H
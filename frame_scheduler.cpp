@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <algorithm>
+#include "frame_scheduler.h"
+
+FrameScheduler::FrameScheduler(std::chrono::microseconds budget):
+    _disp(nullptr),
+    _budget(budget),
+    _queued(0),
+    _estimate(0),
+    _stripes(0),
+    _over_budget(0),
+    _worst_stripe(0),
+    _worst_call(0)
+{
+}
+
+void FrameScheduler::start(lv_disp_t *disp)
+{
+    _disp = disp;
+    _timer.start();
+
+    /* The refresh timer is resumed by every invalidation: make it never due
+     * instead of pausing it */
+    lv_timer_set_period(_disp->refr_timer, UINT32_MAX);
+}
+
+uint32_t FrameScheduler::handler()
+{
+    std::chrono::microseconds start = _timer.elapsed_time();
+    uint32_t next = lv_timer_handler();
+
+    /* Layout changes invalidate areas: update it before collecting them */
+    lv_obj_update_layout(_disp->act_scr);
+    harvest();
+
+    lv_area_t stripe;
+    for (uint32_t done = 0; ; done++) {
+        if (_work) {
+            _work();
+        }
+
+        /* Stop when the next stripe could overrun the budget, but refresh
+         * at least one stripe per call */
+        std::chrono::microseconds now = _timer.elapsed_time();
+        if (done && now - start + _estimate > _budget) {
+            break;
+        }
+        if (!next_stripe(&stripe)) {
+            break;
+        }
+
+        _disp->inv_areas[0] = stripe;
+        _disp->inv_area_joined[0] = 0;
+        _disp->inv_p = 1;
+        _lv_disp_refr_timer(_disp->refr_timer);
+
+        std::chrono::microseconds time = _timer.elapsed_time() - now;
+        /* Follow a slower stripe at once, forget it over a few stripes */
+        _estimate = std::max(time, _estimate - _estimate / 8);
+        _worst_stripe = std::max(_worst_stripe, time);
+        _over_budget += time > _budget;
+        _stripes++;
+    }
+
+    _worst_call = std::max(_worst_call, _timer.elapsed_time() - start);
+
+    return _queued ? 0 : next;
+}
+
+void FrameScheduler::harvest()
+{
+    for (uint16_t i = 0; i < _disp->inv_p; i++) {
+        const lv_area_t *area = &_disp->inv_areas[i];
+        if (_disp->inv_area_joined[i]) {
+            continue;
+        }
+
+        bool covered = false;
+        for (size_t j = 0; j < _queued && !covered; j++) {
+            covered = _lv_area_is_in(area, &_queue[j], 0);
+        }
+        if (covered) {
+            continue;
+        }
+
+        if (_queued < FRAME_SCHEDULER_QUEUE_SIZE) {
+            _queue[_queued++] = *area;
+        } else {
+            _lv_area_join(&_queue[_queued - 1], &_queue[_queued - 1], area);
+        }
+    }
+    _disp->inv_p = 0;
+}
+
+bool FrameScheduler::next_stripe(lv_area_t *stripe)
+{
+    if (!_queued) {
+        return false;
+    }
+
+    /* As many rows of the first area as the draw buffer holds */
+    lv_area_t *area = &_queue[0];
+    lv_coord_t rows = _disp->driver->draw_buf->size / lv_area_get_width(area);
+    rows = LV_MAX(rows, 1);
+
+    *stripe = *area;
+    stripe->y2 = LV_MIN(area->y2, area->y1 + rows - 1);
+    area->y1 = stripe->y2 + 1;
+
+    if (area->y1 > area->y2) {
+        _queued--;
+        memmove(&_queue[0], &_queue[1], _queued * sizeof(lv_area_t));
+    }
+
+    return true;
+}
+
+void FrameScheduler::print_report()
+{
+    printf("scheduler: budget %lu us, %lu stripes, worst stripe %lu us, worst call %lu us, "
+            "%lu stripes over budget\n",
+            (unsigned long)_budget.count(),
+            (unsigned long)_stripes,
+            (unsigned long)_worst_stripe.count(),
+            (unsigned long)_worst_call.count(),
+            (unsigned long)_over_budget);
+
+    _stripes = 0;
+    _over_budget = 0;
+    _worst_stripe = 0us;
+    _worst_call = 0us;
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+#include "mbed.h"
+#include "lvgl.h"
+
+/* Areas waiting to be refreshed, joined when full */
+#ifndef FRAME_SCHEDULER_QUEUE_SIZE
+#define FRAME_SCHEDULER_QUEUE_SIZE LV_INV_BUF_SIZE
+#endif
+
+/**
+ * Replacement of lv_timer_handler() with a time budget per call.
+ *
+ * The LVGL timers run as usual, but the refresh of the display is taken
+ * over: the invalidated areas are queued and refreshed as stripes of the
+ * draw buffer height, while the budget allows it. The remaining stripes
+ * are refreshed by the next calls. The work callback runs before each
+ * stripe, so that high priority application work is never delayed by more
+ * than one stripe.
+ *
+ * A frame may be shown over several calls: a fast changing area can tear.
+ */
+class FrameScheduler {
+public:
+    FrameScheduler(std::chrono::microseconds budget);
+
+    /* Take over the refresh of disp */
+    void start(lv_disp_t *disp);
+
+    /* Work to run between stripes */
+    void set_work(mbed::Callback<void()> work)
+    {
+        _work = work;
+    }
+
+    /* Run the LVGL timers and refresh stripes within the budget. Return the
+     * time in ms until the next call is needed, like lv_timer_handler() */
+    uint32_t handler();
+
+    /* Print the worst stripe and call times since the last report */
+    void print_report();
+
+private:
+    void harvest();
+    bool next_stripe(lv_area_t *stripe);
+
+    lv_disp_t *_disp;
+    std::chrono::microseconds _budget;
+    mbed::Callback<void()> _work;
+    lv_area_t _queue[FRAME_SCHEDULER_QUEUE_SIZE];
+    size_t _queued;
+    Timer _timer;
+    /* Recent stripe time: the longest one, decaying by 1/8 per stripe */
+    std::chrono::microseconds _estimate;
+
+    /* Report */
+    uint32_t _stripes;
+    uint32_t _over_budget;
+    std::chrono::microseconds _worst_stripe;
+    std::chrono::microseconds _worst_call;
+};
+
+#endif // FRAME_SCHEDULER_H
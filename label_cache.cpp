@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "label_cache.h"
+
+struct LabelLine {
+    const char *text;
+    lv_coord_t width;
+};
+
+struct LabelCache {
+    /* Key */
+    const char *text;
+    uint32_t hash;
+    const lv_font_t *font;
+    lv_coord_t width;
+    lv_coord_t letter_space;
+    /* Lines, copied one after the other with their terminator */
+    uint32_t count;
+    LabelLine *lines;
+    char *buf;
+    lv_opa_t opa;
+};
+
+/* FNV-1a */
+static uint32_t hash_text(const char *text)
+{
+    uint32_t hash = 2166136261u;
+
+    while (*text) {
+        hash = (hash ^ (uint8_t)*text++) * 16777619u;
+    }
+
+    return hash;
+}
+
+static void free_lines(LabelCache *cache)
+{
+    lv_mem_free(cache->lines);
+    lv_mem_free(cache->buf);
+    cache->lines = nullptr;
+    cache->buf = nullptr;
+    cache->count = 0;
+}
+
+static bool break_lines(LabelCache *cache, const char *text, lv_coord_t max_width)
+{
+    uint32_t length = strlen(text);
+    uint32_t count = 0;
+
+    /* Same walk as lv_draw_label(): first count, then copy */
+    for (uint32_t ofs = 0; text[ofs]; count++) {
+        ofs += _lv_txt_get_next_line(&text[ofs], cache->font, cache->letter_space, max_width,
+                LV_TEXT_FLAG_NONE);
+    }
+
+    free_lines(cache);
+    cache->lines = (LabelLine *)lv_mem_alloc(count * sizeof(LabelLine));
+    cache->buf = (char *)lv_mem_alloc(length + count + 1);
+    if (!cache->lines || !cache->buf) {
+        free_lines(cache);
+        return false;
+    }
+
+    char *dst = cache->buf;
+    for (uint32_t ofs = 0; text[ofs]; cache->count++) {
+        uint32_t end = _lv_txt_get_next_line(&text[ofs], cache->font, cache->letter_space,
+                max_width, LV_TEXT_FLAG_NONE);
+        uint32_t n = end;
+        while (n && (text[ofs + n - 1] == '\n' || text[ofs + n - 1] == '\r')) {
+            n--;
+        }
+
+        memcpy(dst, &text[ofs], n);
+        dst[n] = '\0';
+        cache->lines[cache->count].text = dst;
+        cache->lines[cache->count].width = _lv_txt_get_width(dst, n, cache->font,
+                cache->letter_space, LV_TEXT_FLAG_NONE);
+        dst += n + 1;
+        ofs += end;
+    }
+
+    return true;
+}
+
+static void draw(LabelCache *cache, lv_obj_t *label, const lv_area_t *clip)
+{
+    lv_area_t coords;
+    lv_obj_get_content_coords(label, &coords);
+    const char *text = lv_label_get_text(label);
+    const lv_font_t *font = lv_obj_get_style_text_font(label, LV_PART_MAIN);
+    lv_coord_t letter_space = lv_obj_get_style_text_letter_space(label, LV_PART_MAIN);
+    lv_coord_t width = lv_label_get_long_mode(label) == LV_LABEL_LONG_WRAP
+            ? lv_area_get_width(&coords) : LV_COORD_MAX;
+    uint32_t hash = hash_text(text);
+
+    if (text != cache->text || hash != cache->hash || font != cache->font
+            || width != cache->width || letter_space != cache->letter_space
+            || (!cache->lines && *text)) {
+        cache->text = text;
+        cache->hash = hash;
+        cache->font = font;
+        cache->width = width;
+        cache->letter_space = letter_space;
+        if (!break_lines(cache, text, width)) {
+            return;
+        }
+    }
+
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    dsc.font = font;
+    dsc.letter_space = letter_space;
+    dsc.line_space = lv_obj_get_style_text_line_space(label, LV_PART_MAIN);
+    dsc.color = lv_obj_get_style_text_color_filtered(label, LV_PART_MAIN);
+    dsc.decor = lv_obj_get_style_text_decor(label, LV_PART_MAIN);
+    dsc.blend_mode = lv_obj_get_style_blend_mode(label, LV_PART_MAIN);
+    dsc.opa = cache->opa;
+#if LV_USE_OPA_SCALE
+    lv_opa_t scale = lv_obj_get_style_opa(label, LV_PART_MAIN);
+    if (scale < LV_OPA_MAX) {
+        dsc.opa = (uint16_t)dsc.opa * scale >> 8;
+    }
+#endif
+    if (dsc.opa <= LV_OPA_MIN) {
+        return;
+    }
+
+    lv_text_align_t align = lv_obj_get_style_text_align(label, LV_PART_MAIN);
+    lv_coord_t line_height = lv_font_get_line_height(font) + dsc.line_space;
+    lv_area_t line = coords;
+
+    /* As the draw_main of the label: the text does not leave the content area */
+    lv_area_t text_clip;
+    if (!_lv_area_intersect(&text_clip, clip, &coords)) {
+        return;
+    }
+
+    for (uint32_t i = 0; i < cache->count && line.y1 <= text_clip.y2; i++) {
+        line.y2 = line.y1 + line_height - 1;
+        if (line.y2 >= text_clip.y1) {
+            /* Aligned here from the cached width: lv_draw_label() does not measure it */
+            lv_coord_t free_width = lv_area_get_width(&coords) - cache->lines[i].width;
+            line.x1 = coords.x1;
+            if (align == LV_TEXT_ALIGN_CENTER) {
+                line.x1 += free_width / 2;
+            } else if (align == LV_TEXT_ALIGN_RIGHT) {
+                line.x1 += free_width;
+            }
+            /* Wide enough for the line not to wrap again */
+            line.x2 = line.x1 + LV_MAX(cache->lines[i].width, lv_area_get_width(&coords)) - 1;
+            lv_draw_label(&line, &text_clip, &dsc, cache->lines[i].text, NULL);
+        }
+        line.y1 += line_height;
+    }
+}
+
+static void event_cb(lv_event_t *e)
+{
+    LabelCache *cache = (LabelCache *)lv_event_get_user_data(e);
+
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_DRAW_MAIN_END:
+            /* After the label, which draws its background only */
+            draw(cache, lv_event_get_target(e), (const lv_area_t *)lv_event_get_param(e));
+            break;
+        case LV_EVENT_DELETE:
+            free_lines(cache);
+            lv_mem_free(cache);
+            break;
+        default:
+            break;
+    }
+}
+
+bool label_cache_attach(lv_obj_t *label)
+{
+    lv_label_long_mode_t mode = lv_label_get_long_mode(label);
+    if ((mode != LV_LABEL_LONG_WRAP && mode != LV_LABEL_LONG_CLIP) || lv_label_get_recolor(label)) {
+        return false;
+    }
+
+    LabelCache *cache = (LabelCache *)lv_mem_alloc(sizeof(LabelCache));
+    if (!cache) {
+        return false;
+    }
+    memset(cache, 0, sizeof(LabelCache));
+    cache->opa = lv_obj_get_style_text_opa(label, LV_PART_MAIN);
+
+    lv_obj_set_style_text_opa(label, LV_OPA_TRANSP, 0);
+    lv_obj_add_event_cb(label, event_cb, LV_EVENT_ALL, cache);
+
+    return true;
+}
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef LABEL_CACHE_H
+#define LABEL_CACHE_H
+
+#include "lvgl.h"
+
+/**
+ * Draw the text of label from cached lines.
+ *
+ * On every redraw, LVGL breaks the text of a label into lines again and
+ * measures each line to align it, even when only its color or position
+ * changed. The cache keeps the line breaks and widths, keyed by the text
+ * (pointer and hash), the font, the width and the letter space, and only
+ * computes them again when one of these changes. Lines outside the redrawn
+ * area are skipped without being measured.
+ *
+ * The LVGL text of the label is made transparent and replaced: the text
+ * opacity at attach time is kept. Only the wrap and clip long modes are
+ * handled, without recoloring: return false, and leave the label as is,
+ * otherwise.
+ */
+bool label_cache_attach(lv_obj_t *label);
+
+#endif // LABEL_CACHE_H
@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "layer_cache.h"
+
+/* The refresh of LVGL (lv_refr_obj()) for one tree, clipped to clip */
+static void draw_tree(lv_obj_t *obj, const lv_area_t *clip, bool root)
+{
+    /* The root of a layer is hidden, the layer draws it anyway */
+    if (!root && lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) {
+        return;
+    }
+
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    lv_coord_t ext = _lv_obj_get_ext_draw_size(obj);
+    lv_area_t area = {
+        (lv_coord_t)(coords.x1 - ext), (lv_coord_t)(coords.y1 - ext),
+        (lv_coord_t)(coords.x2 + ext), (lv_coord_t)(coords.y2 + ext)
+    };
+    lv_area_t mask;
+    if (!_lv_area_intersect(&mask, clip, &area)) {
+        return;
+    }
+
+    lv_event_send(obj, LV_EVENT_DRAW_MAIN_BEGIN, &mask);
+    lv_event_send(obj, LV_EVENT_DRAW_MAIN, &mask);
+    lv_event_send(obj, LV_EVENT_DRAW_MAIN_END, &mask);
+
+    lv_area_t content;
+    if (_lv_area_intersect(&content, clip, &coords)) {
+        for (uint32_t i = 0; i < lv_obj_get_child_cnt(obj); i++) {
+            draw_tree(lv_obj_get_child(obj, i), &content, false);
+        }
+    }
+
+    lv_event_send(obj, LV_EVENT_DRAW_POST_BEGIN, &mask);
+    lv_event_send(obj, LV_EVENT_DRAW_POST, &mask);
+    lv_event_send(obj, LV_EVENT_DRAW_POST_END, &mask);
+}
+
+/* Over black a pixel is c * a, over white c * a + (1 - a): the difference
+ * gives the alpha, green has the most bits. RGB565, not swapped */
+static void unblend(uint8_t *px, uint16_t black, uint16_t white)
+{
+    int32_t green = (black >> 5) & 0x3F;
+    int32_t alpha = 255 - (((white >> 5) & 0x3F) - green) * 255 / 0x3F;
+    uint16_t color = 0;
+
+    alpha = LV_CLAMP(0, alpha, 255);
+    if (alpha > LV_OPA_MIN) {
+        int32_t r = LV_MIN((black >> 11) * 255 / alpha, 0x1F);
+        int32_t g = LV_MIN(green * 255 / alpha, 0x3F);
+        int32_t b = LV_MIN((black & 0x1F) * 255 / alpha, 0x1F);
+        color = (uint16_t)((r << 11) | (g << 5) | b);
+    } else {
+        alpha = 0;
+    }
+
+    px[0] = color & 0xFF;
+    px[1] = color >> 8;
+    px[2] = (uint8_t)alpha;
+}
+
+/* Whether a parent of obj masks its children while they are drawn */
+static bool is_masked(lv_obj_t *obj)
+{
+    for (lv_obj_t *o = lv_obj_get_parent(obj); o; o = lv_obj_get_parent(o)) {
+        if (lv_obj_get_style_clip_corner(o, LV_PART_MAIN) && lv_obj_get_style_radius(o, LV_PART_MAIN)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+LayerCache::LayerCache(uint32_t budget):
+    _layers(),
+    _budget(budget),
+    _used(0)
+{
+}
+
+int LayerCache::cache(lv_obj_t *root)
+{
+    Layer *layer = nullptr;
+
+    for (Layer &l : _layers) {
+        if (l.root == root) {
+            return ERROR_OK;
+        }
+        if (!l.root && !layer) {
+            layer = &l;
+        }
+    }
+    if (!layer) {
+        return ERROR_FULL;
+    }
+    if (is_masked(root)) {
+        return ERROR_MASKED;
+    }
+
+    lv_obj_update_layout(lv_obj_get_screen(root));
+    *layer = {};
+    layer->cache = this;
+    layer->root = root;
+    int err = resize(layer);
+    if (err != ERROR_OK) {
+        layer->root = nullptr;
+        return err;
+    }
+
+    /* The image takes the place of the root in the drawing order */
+    lv_obj_t *parent = lv_obj_get_parent(root);
+    uint32_t index = lv_obj_get_index(root);
+    layer->image = lv_img_create(parent);
+    lv_obj_add_flag(layer->image, LV_OBJ_FLAG_IGNORE_LAYOUT);
+    lv_obj_clear_flag(layer->image, LV_OBJ_FLAG_CLICKABLE);
+    lv_img_set_src(layer->image, &layer->dsc);
+    while (lv_obj_get_index(layer->image) > index + 1) {
+        lv_obj_move_foreground(lv_obj_get_child(parent, index + 1));
+    }
+    lv_obj_align_to(layer->image, root, LV_ALIGN_TOP_LEFT, 0, 0);
+
+    lv_obj_add_flag(root, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_event_cb(root, root_event_cb, LV_EVENT_ALL, layer);
+    lv_obj_add_event_cb(layer->image, image_event_cb, LV_EVENT_ALL, layer);
+
+    return ERROR_OK;
+}
+
+void LayerCache::set_opa(lv_obj_t *root, lv_opa_t opa)
+{
+    Layer *layer = find(root);
+
+    if (layer) {
+        lv_obj_set_style_img_opa(layer->image, opa, 0);
+    }
+}
+
+void LayerCache::invalidate(lv_obj_t *obj)
+{
+    Layer *layer = find(obj);
+
+    if (layer) {
+        layer->dirty = true;
+        lv_obj_invalidate(layer->image);
+    }
+}
+
+void LayerCache::release(lv_obj_t *root)
+{
+    Layer *layer = find(root);
+
+    if (layer && layer->root == root) {
+        lv_obj_remove_event_cb(root, root_event_cb);
+        lv_obj_clear_flag(root, LV_OBJ_FLAG_HIDDEN);
+        free_layer(layer, false);
+    }
+}
+
+void LayerCache::root_event_cb(lv_event_t *e)
+{
+    Layer *layer = (Layer *)lv_event_get_user_data(e);
+
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_SIZE_CHANGED:
+            /* Sent on moves too: only a new size needs a new layer */
+            if (layer->cache->resize(layer) != ERROR_OK) {
+                /* Over the budget: live again. The parent may be laid out,
+                 * the image is deleted later */
+                lv_obj_remove_event_cb(layer->root, root_event_cb);
+                lv_obj_clear_flag(layer->root, LV_OBJ_FLAG_HIDDEN);
+                layer->cache->free_layer(layer, true);
+                break;
+            }
+            lv_obj_align_to(layer->image, layer->root, LV_ALIGN_TOP_LEFT, 0, 0);
+            break;
+        case LV_EVENT_STYLE_CHANGED:
+        case LV_EVENT_CHILD_CHANGED:
+            layer->cache->invalidate(layer->root);
+            break;
+        case LV_EVENT_DELETE:
+            /* The image goes with its root, also when their parent is deleted */
+            layer->cache->free_layer(layer, false);
+            break;
+        default:
+            break;
+    }
+}
+
+void LayerCache::image_event_cb(lv_event_t *e)
+{
+    Layer *layer = (Layer *)lv_event_get_user_data(e);
+
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_DRAW_MAIN_BEGIN:
+            /* Before the image is blended. No parent masks apply to this
+             * rendering, cache() checked it */
+            if (layer->dirty) {
+                layer->cache->render(layer);
+            }
+            break;
+        case LV_EVENT_DELETE:
+            /* Deleted with its parent, or after its layer was freed */
+            if (layer->image == lv_event_get_target(e)) {
+                layer->image = nullptr;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+LayerCache::Layer *LayerCache::find(lv_obj_t *obj)
+{
+    for (lv_obj_t *o = obj; o; o = lv_obj_get_parent(o)) {
+        for (Layer &layer : _layers) {
+            if (layer.root == o) {
+                return &layer;
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+int LayerCache::resize(Layer *layer)
+{
+    lv_coord_t width = lv_obj_get_width(layer->root);
+    lv_coord_t height = lv_obj_get_height(layer->root);
+
+    if (layer->dsc.data && layer->dsc.header.w == width && layer->dsc.header.h == height) {
+        return ERROR_OK;
+    }
+
+    uint32_t size = (uint32_t)width * height * LV_IMG_PX_SIZE_ALPHA_BYTE;
+    if (_used - layer->dsc.data_size + size > _budget) {
+        return ERROR_BUDGET;
+    }
+
+    lv_img_cache_invalidate_src(&layer->dsc);
+    lv_mem_free((void *)layer->dsc.data);
+    _used -= layer->dsc.data_size;
+    layer->dsc.data_size = 0;
+    layer->dsc.data = (const uint8_t *)lv_mem_alloc(size);
+    if (!layer->dsc.data) {
+        return ERROR_NO_MEMORY;
+    }
+    _used += size;
+
+    layer->dsc.header.always_zero = 0;
+    layer->dsc.header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    layer->dsc.header.w = width;
+    layer->dsc.header.h = height;
+    layer->dsc.data_size = size;
+    layer->dirty = true;
+    if (layer->image) {
+        lv_img_set_src(layer->image, &layer->dsc);
+    }
+
+    return ERROR_OK;
+}
+
+void LayerCache::render(Layer *layer)
+{
+    lv_coord_t width = layer->dsc.header.w;
+    lv_color_t *stripe = (lv_color_t *)lv_mem_alloc(width * LAYER_CACHE_STRIPE_ROWS * sizeof(lv_color_t));
+    if (!stripe) {
+        /* Still dirty: tried again at the next redraw */
+        return;
+    }
+
+    /* The draw functions render into the buffer of the display being
+     * refreshed: a copy of the display with the stripe as buffer */
+    lv_disp_t *disp = lv_obj_get_disp(layer->root);
+    lv_disp_drv_t driver = *disp->driver;
+    lv_disp_draw_buf_t draw_buf = *driver.draw_buf;
+    lv_disp_t stripe_disp = *disp;
+    draw_buf.buf_act = stripe;
+    driver.draw_buf = &draw_buf;
+    driver.set_px_cb = nullptr;
+    stripe_disp.driver = &driver;
+
+    lv_disp_t *refreshing = _lv_refr_get_disp_refreshing();
+    _lv_refr_set_disp_refreshing(&stripe_disp);
+
+    lv_area_t coords;
+    lv_obj_get_coords(layer->root, &coords);
+    uint8_t *out = (uint8_t *)layer->dsc.data;
+    for (lv_coord_t y = coords.y1; y <= coords.y2; y += LAYER_CACHE_STRIPE_ROWS) {
+        lv_area_t area = {coords.x1, y, coords.x2,
+                (lv_coord_t)LV_MIN(y + LAYER_CACHE_STRIPE_ROWS - 1, coords.y2)};
+        uint32_t count = lv_area_get_size(&area);
+        draw_buf.area = area;
+
+        for (uint32_t i = 0; i < count; i++) {
+            stripe[i].full = 0x0000;
+        }
+        draw_tree(layer->root, &area, true);
+        for (uint32_t i = 0; i < count; i++) {
+            out[i * LV_IMG_PX_SIZE_ALPHA_BYTE] = stripe[i].full & 0xFF;
+            out[i * LV_IMG_PX_SIZE_ALPHA_BYTE + 1] = stripe[i].full >> 8;
+            stripe[i].full = 0xFFFF;
+        }
+        draw_tree(layer->root, &area, true);
+        for (uint32_t i = 0; i < count; i++) {
+            uint8_t *px = &out[i * LV_IMG_PX_SIZE_ALPHA_BYTE];
+            unblend(px, px[0] | (px[1] << 8), stripe[i].full);
+        }
+        out += count * LV_IMG_PX_SIZE_ALPHA_BYTE;
+    }
+
+    _lv_refr_set_disp_refreshing(refreshing);
+    lv_mem_free(stripe);
+    lv_img_cache_invalidate_src(&layer->dsc);
+    layer->dirty = false;
+}
+
+void LayerCache::free_layer(Layer *layer, bool async)
+{
+    if (layer->image) {
+        lv_obj_t *image = layer->image;
+        layer->image = nullptr;
+        if (async) {
+            lv_obj_add_flag(image, LV_OBJ_FLAG_HIDDEN);
+            lv_obj_del_async(image);
+        } else {
+            lv_obj_del(image);
+        }
+    }
+    lv_img_cache_invalidate_src(&layer->dsc);
+    lv_mem_free((void *)layer->dsc.data);
+    _used -= layer->dsc.data_size;
+    layer->dsc = {};
+    layer->root = nullptr;
+}
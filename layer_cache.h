@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef LAYER_CACHE_H
+#define LAYER_CACHE_H
+
+#include "lvgl.h"
+
+/* LVGL heap bytes the layers may hold, 3 bytes per pixel */
+#ifndef LAYER_CACHE_BUDGET
+#define LAYER_CACHE_BUDGET (12U * 1024U)
+#endif
+
+/* Subtrees cached at the same time */
+#ifndef LAYER_CACHE_MAX_LAYERS
+#define LAYER_CACHE_MAX_LAYERS 4
+#endif
+
+/* Rows rendered at a time while a layer is built */
+#ifndef LAYER_CACHE_STRIPE_ROWS
+#define LAYER_CACHE_STRIPE_ROWS 8
+#endif
+
+/**
+ * Widget subtrees rendered once into an off-screen RGB565 + alpha layer.
+ *
+ * A semi-transparent or faded container is normally drawn again, with all
+ * its children blended one by one, whenever anything over or under it is
+ * invalidated. cache() renders the subtree of a root once, then hides the
+ * root and shows the layer in its place with an image: redraws only blend
+ * the image.
+ *
+ * The layer follows the root when it moves, set_opa() fades the whole layer
+ * at once, and objects drawn over it only cost the covered part. The layer
+ * is rendered again, at the next redraw, when the root is resized or its
+ * style or children change; content changes deeper in the tree (text,
+ * values...) must be reported with invalidate().
+ *
+ * The alpha is recovered by rendering each stripe over black and over
+ * white. Parts of the tree outside the root (shadows...) are not kept. The
+ * layer is rendered while the screen is drawn, under the masks of the
+ * parents of the root: a root with a parent clipping its corners is not
+ * cached, as its layer would keep the corners of the place it was built. As
+ * the root is hidden, it no longer takes space in a flex or grid parent and
+ * its tree no longer gets input.
+ */
+class LayerCache {
+public:
+    enum Error {
+        ERROR_OK = 0,
+        ERROR_FULL = -1,      /* LAYER_CACHE_MAX_LAYERS already cached */
+        ERROR_BUDGET = -2,    /* the layer does not fit in the budget */
+        ERROR_NO_MEMORY = -3, /* the LVGL heap is full */
+        ERROR_MASKED = -4,    /* a parent clips its children to its radius */
+    };
+
+    LayerCache(uint32_t budget = LAYER_CACHE_BUDGET);
+
+    /* Show root and its tree through a cached layer */
+    int cache(lv_obj_t *root);
+
+    /* Opacity of the whole layer, without rendering it again */
+    void set_opa(lv_obj_t *root, lv_opa_t opa);
+
+    /* Render the layer holding obj again, at the next redraw */
+    void invalidate(lv_obj_t *obj);
+
+    /* Show root live again and free its layer */
+    void release(lv_obj_t *root);
+
+    /* Bytes held by the layers */
+    uint32_t used() const
+    {
+        return _used;
+    }
+
+private:
+    struct Layer {
+        LayerCache *cache;
+        lv_obj_t *root;
+        lv_obj_t *image;
+        lv_img_dsc_t dsc;
+        bool dirty;
+    };
+
+    static void root_event_cb(lv_event_t *e);
+    static void image_event_cb(lv_event_t *e);
+
+    Layer *find(lv_obj_t *obj);
+    int resize(Layer *layer);
+    void render(Layer *layer);
+    void free_layer(Layer *layer, bool async);
+
+    Layer _layers[LAYER_CACHE_MAX_LAYERS];
+    uint32_t _budget;
+    uint32_t _used;
+};
+
+#endif // LAYER_CACHE_H
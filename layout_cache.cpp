@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "layout_cache.h"
+
+/* Sizes computed from the content or from the parent */
+static bool is_computed(lv_coord_t size)
+{
+    return size == LV_SIZE_CONTENT || LV_COORD_IS_PCT(size);
+}
+
+/* Pin obj to its current size. The style change marks obj and its parent
+ * as dirty: the caller clears it once they are laid out */
+static void pin_size(lv_obj_t *obj)
+{
+    lv_obj_set_size(obj, lv_obj_get_width(obj), lv_obj_get_height(obj));
+}
+
+/* Clear the layout flags of the tree of obj, of its ancestors and of the
+ * screen, when all of them are up to date */
+static void clear_dirty(lv_obj_t *obj, bool tree)
+{
+    if (tree) {
+        for (uint32_t i = 0; i < lv_obj_get_child_cnt(obj); i++) {
+            clear_dirty(lv_obj_get_child(obj, i), true);
+        }
+    }
+    for (lv_obj_t *o = obj; o; o = lv_obj_get_parent(o)) {
+        o->layout_inv = 0;
+    }
+    lv_obj_get_screen(obj)->scr_layout_inv = 0;
+}
+
+LayoutCache::LayoutCache():
+    _count(0)
+{
+}
+
+int LayoutCache::pin(lv_obj_t *root)
+{
+    size_t first = _count;
+
+    lv_obj_update_layout(lv_obj_get_screen(root));
+    bool full = !pin_tree(root);
+    clear_dirty(root, true);
+
+    return full ? -1 : (int)(_count - first);
+}
+
+bool LayoutCache::pin_tree(lv_obj_t *obj)
+{
+    lv_coord_t width = lv_obj_get_style_width(obj, LV_PART_MAIN);
+    lv_coord_t height = lv_obj_get_style_height(obj, LV_PART_MAIN);
+
+    if ((is_computed(width) || is_computed(height)) && !find(obj)) {
+        if (_count == LAYOUT_CACHE_MAX_OBJS) {
+            return false;
+        }
+        _entries[_count++] = {obj, width, height};
+        pin_size(obj);
+    }
+
+    for (uint32_t i = 0; i < lv_obj_get_child_cnt(obj); i++) {
+        if (!pin_tree(lv_obj_get_child(obj, i))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void LayoutCache::invalidate(lv_obj_t *obj)
+{
+    /* Dirty objects left by the application are laid out by the next
+     * update, whatever is done here */
+    bool pending = lv_obj_get_screen(obj)->scr_layout_inv;
+    lv_obj_t *o = obj;
+    bool changed = true;
+
+    /* Without a layout, the content size of an object only depends on the
+     * size of its children, which are placed by their own position */
+    for (Entry *entry = find(o); changed && entry; entry = o ? find(o) : nullptr) {
+        if (lv_obj_get_style_layout(o, LV_PART_MAIN)) {
+            relayout(o);
+            return;
+        }
+        changed = measure(o, entry);
+        o = lv_obj_get_parent(o);
+    }
+
+    /* The size change stops at o, which lays out its children with LVGL
+     * (flagged by the size change) or places them by their own position */
+    if (!pending && !(changed && o && lv_obj_get_style_layout(o, LV_PART_MAIN))) {
+        clear_dirty(obj, false);
+    }
+}
+
+bool LayoutCache::measure(lv_obj_t *obj, const Entry *entry)
+{
+    lv_coord_t width = lv_obj_get_width(obj);
+    lv_coord_t height = lv_obj_get_height(obj);
+
+    lv_obj_set_size(obj, entry->width, entry->height);
+    lv_obj_refr_size(obj);
+    /* Aligned objects move with their size */
+    lv_obj_refr_pos(obj);
+    pin_size(obj);
+
+    return lv_obj_get_width(obj) != width || lv_obj_get_height(obj) != height;
+}
+
+/* obj is pinned and has a layout: its content size depends on where the
+ * layout places its children. Restore its original sizes and the ones of
+ * its pinned ancestors, and let LVGL lay them out */
+void LayoutCache::relayout(lv_obj_t *obj)
+{
+    for (lv_obj_t *o = obj; o; o = lv_obj_get_parent(o)) {
+        Entry *entry = find(o);
+        if (entry) {
+            lv_obj_set_size(o, entry->width, entry->height);
+        }
+    }
+
+    lv_obj_update_layout(obj);
+
+    for (lv_obj_t *o = obj; o; o = lv_obj_get_parent(o)) {
+        if (find(o)) {
+            pin_size(o);
+        }
+    }
+    clear_dirty(obj, false);
+}
+
+void LayoutCache::clear()
+{
+    for (size_t i = 0; i < _count; i++) {
+        lv_obj_set_size(_entries[i].obj, _entries[i].width, _entries[i].height);
+    }
+    _count = 0;
+}
+
+LayoutCache::Entry *LayoutCache::find(lv_obj_t *obj)
+{
+    for (size_t i = 0; i < _count; i++) {
+        if (_entries[i].obj == obj) {
+            return &_entries[i];
+        }
+    }
+
+    return nullptr;
+}
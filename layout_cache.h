@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef LAYOUT_CACHE_H
+#define LAYOUT_CACHE_H
+
+#include "lvgl.h"
+
+/* Objects whose layout can be pinned */
+#ifndef LAYOUT_CACHE_MAX_OBJS
+#define LAYOUT_CACHE_MAX_OBJS 128
+#endif
+
+/**
+ * Cache of the computed sizes of a widget tree.
+ *
+ * Content and percent sized objects are laid out again whenever their
+ * content changes, and so are their parents and siblings: a label going
+ * from "12.3" to "12.4" relays out its whole container. pin() lays out a
+ * tree once and fixes these sizes to their computed values, so content
+ * changes no longer mark anything as dirty.
+ *
+ * When the content of an object may change its size (longer text...),
+ * invalidate() measures it again, then its pinned ancestors while their
+ * size changes, and pins the new results: only the path whose input changed
+ * is recomputed, and nothing is left dirty for the next layout update. A
+ * size change reaching an object with a layout (flex, grid) is left to
+ * LVGL, which places its children again.
+ *
+ * The cache keeps pointers to the objects: clear() it before deleting them.
+ */
+class LayoutCache {
+public:
+    LayoutCache();
+
+    /* Lay out root and pin the sizes of its tree. Return the number of
+     * objects pinned, or -1 when the cache is full (the rest is not pinned) */
+    int pin(lv_obj_t *root);
+
+    /* Measure obj and its pinned ancestors again, as far as sizes change */
+    void invalidate(lv_obj_t *obj);
+
+    /* Restore the original sizes of all the pinned objects */
+    void clear();
+
+private:
+    struct Entry {
+        lv_obj_t *obj;
+        lv_coord_t width;
+        lv_coord_t height;
+    };
+
+    bool pin_tree(lv_obj_t *obj);
+    bool measure(lv_obj_t *obj, const Entry *entry);
+    void relayout(lv_obj_t *obj);
+    Entry *find(lv_obj_t *obj);
+
+    Entry _entries[LAYOUT_CACHE_MAX_OBJS];
+    size_t _count;
+};
+
+#endif // LAYOUT_CACHE_H
@@ -48,7 +48,9 @@
 
 /* Default display refresh period.
  * Can be changed in the display driver (`lv_disp_drv_t`).*/
+#ifndef LV_DISP_DEF_REFR_PERIOD
 #define LV_DISP_DEF_REFR_PERIOD      30      /*[ms]*/
+#endif
 
 /* Dot Per Inch: used to initialize default sizes.
  * E.g. a button with width = LV_DPI / 2 -> half inch wide
@@ -80,7 +82,9 @@ typedef int16_t lv_coord_t;
 #define LV_MEM_CUSTOM      0
 #if LV_MEM_CUSTOM == 0
 /* Size of the memory used by `lv_mem_alloc` in bytes (>= 2kB)*/
+#  ifndef LV_MEM_SIZE
 #  define LV_MEM_SIZE    (32U * 1024U)
+#  endif
 
 /* Complier prefix for a big array declaration */
 #  define LV_MEM_ATTR
@@ -161,8 +165,10 @@ typedef void * lv_anim_user_data_t;
  * LV_SHADOW_CACHE_SIZE is the max. shadow size to buffer,
  * where shadow size is `shadow_width + radius`
  * Caching has LV_SHADOW_CACHE_SIZE^2 RAM cost*/
+#ifndef LV_SHADOW_CACHE_SIZE
 #define LV_SHADOW_CACHE_SIZE    0
 #endif
+#endif
 
 /*1: enable outline drawing on rectangles*/
 #define LV_USE_OUTLINE  1
@@ -241,7 +247,9 @@ typedef void * lv_fs_drv_user_data_t;
  * With complex image decoders (e.g. PNG or JPG) caching can save the continuous open/decode of images.
  * However the opened images might consume additional RAM.
  * LV_IMG_CACHE_DEF_SIZE must be >= 1 */
+#ifndef LV_IMG_CACHE_DEF_SIZE
 #define LV_IMG_CACHE_DEF_SIZE       1
+#endif
 
 /*Declare the type of the user data of image decoder (can be e.g. `void *`, `int`, `struct`)*/
 typedef void * lv_img_decoder_user_data_t;
@@ -262,23 +270,29 @@ typedef void * lv_img_decoder_user_data_t;
 /* Define a custom attribute to `lv_disp_flush_ready` function */
 #define LV_ATTRIBUTE_FLUSH_READY
 
-/* Required alignment size for buffers */
-#define LV_ATTRIBUTE_MEM_ALIGN_SIZE
+/* Required alignment size for buffers: word aligned for the SPI DMA */
+#define LV_ATTRIBUTE_MEM_ALIGN_SIZE 4
 
 /* With size optimization (-Os) the compiler might not align data to
  * 4 or 8 byte boundary. Some HW may need even 32 or 64 bytes.
  * This alignment will be explicitly applied where needed.
  * LV_ATTRIBUTE_MEM_ALIGN_SIZE should be used to specify required align size.
  * E.g. __attribute__((aligned(LV_ATTRIBUTE_MEM_ALIGN_SIZE))) */
-#define LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN __attribute__((aligned(LV_ATTRIBUTE_MEM_ALIGN_SIZE)))
 
 /* Attribute to mark large constant arrays for example
  * font's bitmaps */
 #define LV_ATTRIBUTE_LARGE_CONST
 
 /* Prefix performance critical functions to place them into a faster memory (e.g RAM)
- * Uses 15-20 kB extra memory */
+ * Uses 15-20 kB extra memory.
+ * With the fast-mem option, they go to SRAM2 at its code bus alias, placed by
+ * fast_mem.ld (fast_mem.json build profile) and copied there by main() */
+#if defined(MBED_CONF_APP_FAST_MEM) && MBED_CONF_APP_FAST_MEM
+#define LV_ATTRIBUTE_FAST_MEM __attribute__((section(".fast_code")))
+#else
 #define LV_ATTRIBUTE_FAST_MEM
+#endif
 
 /* Export integer constant to binding.
  * This macro is used with constants in the form of LV_<CONST> that
@@ -289,8 +303,9 @@ typedef void * lv_img_decoder_user_data_t;
 #define LV_EXPORT_CONST_INT(int_value) struct _silence_gcc_warning
 
 /* Prefix variables that are used in GPU accelerated operations, often these need to be
- * placed in RAM sections that are DMA accessible */
-#define LV_ATTRIBUTE_DMA
+ * placed in RAM sections that are DMA accessible.
+ * Used for the draw buffers: all the SRAM is DMA accessible on the STM32L4 */
+#define LV_ATTRIBUTE_DMA LV_ATTRIBUTE_MEM_ALIGN
 
 /*===================
  *  HAL settings
@@ -312,7 +327,11 @@ typedef void * lv_indev_drv_user_data_t;            /*Type of user data in the i
  *===============*/
 
 /*1: Enable the log module*/
+#if defined(MBED_CONF_APP_BINARY_LOG) && MBED_CONF_APP_BINARY_LOG
+#define LV_USE_LOG      1
+#else
 #define LV_USE_LOG      0
+#endif
 #if LV_USE_LOG
 /* How important log should be added:
  * LV_LOG_LEVEL_TRACE       A lot of logs to give detailed information
@@ -326,6 +345,13 @@ typedef void * lv_indev_drv_user_data_t;            /*Type of user data in the i
 /* 1: Print the log with 'printf';
  * 0: user need to register a callback with `lv_log_register_print_cb`*/
 #  define LV_LOG_PRINTF   0
+
+/* The messages are not formatted on the target: their format address and
+ * arguments go to a RAM ring drained to the SWO (binary_log.h) */
+#  include "binary_log.h"
+#  define LV_LOG_WARN(...)    BINARY_LOG(LV_LOG_LEVEL_WARN, __VA_ARGS__)
+#  define LV_LOG_ERROR(...)   BINARY_LOG(LV_LOG_LEVEL_ERROR, __VA_ARGS__)
+#  define LV_LOG_USER(...)    BINARY_LOG(LV_LOG_LEVEL_USER, __VA_ARGS__)
 #endif  /*LV_USE_LOG*/
 
 /*=================
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "lv_fs_mbed.h"
+
+static void *fs_open(lv_fs_drv_t *drv, const char *path, lv_fs_mode_t mode)
+{
+    FileSystem *fs = static_cast<FileSystem *>(drv->user_data);
+    int flags;
+
+    if (mode == (LV_FS_MODE_WR | LV_FS_MODE_RD)) {
+        flags = O_RDWR | O_CREAT;
+    } else if (mode == LV_FS_MODE_WR) {
+        flags = O_WRONLY | O_CREAT | O_TRUNC;
+    } else {
+        flags = O_RDONLY;
+    }
+
+    while (*path == '/') {
+        path++;
+    }
+
+    File *file = new File;
+    if (file->open(fs, path, flags) != 0) {
+        delete file;
+        return NULL;
+    }
+
+    return file;
+}
+
+static lv_fs_res_t fs_close(lv_fs_drv_t *drv, void *file_p)
+{
+    File *file = static_cast<File *>(file_p);
+    int err = file->close();
+    delete file;
+
+    return err ? LV_FS_RES_FS_ERR : LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_read(lv_fs_drv_t *drv, void *file_p, void *buf, uint32_t btr, uint32_t *br)
+{
+    ssize_t count = static_cast<File *>(file_p)->read(buf, btr);
+    if (count < 0) {
+        *br = 0;
+        return LV_FS_RES_FS_ERR;
+    }
+
+    *br = count;
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_write(lv_fs_drv_t *drv, void *file_p, const void *buf, uint32_t btw, uint32_t *bw)
+{
+    ssize_t count = static_cast<File *>(file_p)->write(buf, btw);
+    if (count < 0) {
+        *bw = 0;
+        return LV_FS_RES_FS_ERR;
+    }
+
+    *bw = count;
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_seek(lv_fs_drv_t *drv, void *file_p, uint32_t pos, lv_fs_whence_t whence)
+{
+    int origin;
+
+    switch (whence) {
+        case LV_FS_SEEK_CUR:
+            origin = SEEK_CUR;
+            break;
+        case LV_FS_SEEK_END:
+            origin = SEEK_END;
+            break;
+        default:
+            origin = SEEK_SET;
+            break;
+    }
+
+    return static_cast<File *>(file_p)->seek(pos, origin) < 0 ? LV_FS_RES_FS_ERR : LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_tell(lv_fs_drv_t *drv, void *file_p, uint32_t *pos_p)
+{
+    off_t pos = static_cast<File *>(file_p)->tell();
+    if (pos < 0) {
+        return LV_FS_RES_FS_ERR;
+    }
+
+    *pos_p = pos;
+    return LV_FS_RES_OK;
+}
+
+void lv_fs_mbed_init(char letter, FileSystem *fs)
+{
+    static lv_fs_drv_t drv;
+
+    lv_fs_drv_init(&drv);
+    drv.letter = letter;
+    drv.open_cb = fs_open;
+    drv.close_cb = fs_close;
+    drv.read_cb = fs_read;
+    drv.write_cb = fs_write;
+    drv.seek_cb = fs_seek;
+    drv.tell_cb = fs_tell;
+    drv.user_data = fs;
+    lv_fs_drv_register(&drv);
+}
@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef LV_FS_MBED_H
+#define LV_FS_MBED_H
+
+#include "mbed.h"
+#include "lvgl.h"
+
+/**
+ * Register an LVGL file system driver backed by a mounted Mbed FileSystem.
+ *
+ * Files of fs are then opened by LVGL as "<letter>:path", e.g. with
+ * lv_img_set_src(img, "F:logo.rli").
+ */
+void lv_fs_mbed_init(char letter, FileSystem *fs);
+
+#endif // LV_FS_MBED_H
@@ -3,10 +3,27 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
+#include <algorithm>
 #include "mbed.h"
 #include "lvgl.h"
 #include "ili9163c.h"
 #include "swo.h"
+#include "panel_io.h"
+#include "panel.h"
+#include "bus_tuner.h"
+#include "frame_scheduler.h"
+#include "ui_batch.h"
+#include "stream_chart.h"
+#include "screen_mirror.h"
+#include "demo_screens.h"
+#include "bench.h"
+#include "binary_log.h"
+#include "boot_timeline.h"
+#include "screen_cache.h"
+#include "lv_fs_mbed.h"
+#include "rle_image.h"
+#include "LittleFileSystem.h"
 
 using namespace sixtron;
 
@@ -14,80 +31,315 @@ using namespace sixtron;
 static const uint16_t screenWidth = 128;
 static const uint16_t screenHeight = 160;
 
-static lv_disp_draw_buf_t draw_buf;
-static lv_color_t buf[screenWidth * 10];
+/* Two draw buffers per panel: LVGL renders into one while the other is sent */
+static const uint32_t drawBufSize = screenWidth * MBED_CONF_APP_DRAW_BUF_ROWS;
+static LV_ATTRIBUTE_DMA lv_color_t buf1[drawBufSize];
+static LV_ATTRIBUTE_DMA lv_color_t buf2[drawBufSize];
 
 static SPI spi(SPI1_MOSI, SPI1_MISO, SPI1_SCK);
+static BusArbiter bus;
 ILI9163C display(&spi, SPI1_CS, DIO18, PWM1_OUT);
+static PanelIO panel_io(&display, &spi, SPI1_CS, DIO18);
+static Panel panel(&bus, &panel_io, screenWidth, screenHeight, buf1, buf2, drawBufSize);
 
-/* Display flushing */
-void my_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p)
+#if MBED_CONF_APP_SECOND_PANEL
+/* Second panel on the same bus, with its own chip select and D/C lines */
+static LV_ATTRIBUTE_DMA lv_color_t second_buf1[drawBufSize];
+static LV_ATTRIBUTE_DMA lv_color_t second_buf2[drawBufSize];
+static ILI9163C second_display(&spi, MBED_CONF_APP_SECOND_PANEL_CS,
+        MBED_CONF_APP_SECOND_PANEL_DC, MBED_CONF_APP_SECOND_PANEL_BACKLIGHT);
+static PanelIO second_panel_io(&second_display, &spi,
+        MBED_CONF_APP_SECOND_PANEL_CS, MBED_CONF_APP_SECOND_PANEL_DC);
+static Panel second_panel(&bus, &second_panel_io, screenWidth, screenHeight,
+        second_buf1, second_buf2, drawBufSize);
+#endif
+
+#if MBED_CONF_APP_FLUSH_FILTER
+static FlushFilter flush_filter;
+#endif
+
+#if MBED_CONF_APP_RGB444_FLUSH
+/* The demo screens hold a few saturated colors: 12 bits are enough */
+static PanelIO::PixelFormat demo_format(const lv_area_t *area)
 {
-    uint32_t w = (area->x2 - area->x1 + 1);
-    uint32_t h = (area->y2 - area->y1 + 1);
+    return PanelIO::PixelFormat::RGB444;
+}
+#endif
+
+#if MBED_CONF_APP_BUS_TUNING
+static BusTuner tuner(&panel_io, screenWidth, screenHeight);
+#endif
+
+#if MBED_CONF_APP_SCREEN_MIRROR
+static BufferedSerial mirror_link(MBED_CONF_APP_MIRROR_TX, MBED_CONF_APP_MIRROR_RX,
+        MBED_CONF_APP_MIRROR_BAUDRATE);
+static ScreenMirror mirror(&mirror_link);
+#endif
 
-    display.setAddr(area->x1, area->y1, area->x2, area->y2);
-    display.write_data_16((uint16_t *)&color_p->full, w * h);
+#if MBED_CONF_APP_SCREEN_CACHE
+#define SPLASH_SLOT 0
+static SlicingBlockDevice screen_cache_bd(BlockDevice::get_default_instance(),
+        0, MBED_CONF_APP_SCREEN_CACHE_SIZE);
+static ScreenCache screen_cache(&screen_cache_bd, &panel_io, screenWidth, screenHeight);
+#endif
+
+#if MBED_CONF_APP_ASSET_FS
+/* Assets live on the storage after the screen cache */
+static SlicingBlockDevice asset_bd(BlockDevice::get_default_instance(),
+        MBED_CONF_APP_SCREEN_CACHE ? MBED_CONF_APP_SCREEN_CACHE_SIZE : 0);
+static LittleFileSystem asset_fs("fs");
+#endif
+
+#if MBED_CONF_APP_DEMO_STREAM_CHART
+static StreamChart chart(&panel_io, {0, 50, screenWidth - 1, 109});
+static Ticker sampler;
+
+/* Triangle wave standing in for a sensor */
+void sample_sensor()
+{
+    static int32_t value = 0;
+    static int32_t step = 3;
 
-    lv_disp_flush_ready(disp);
+    value += step;
+    if (value <= 0 || value >= 100) {
+        step = -step;
+    }
+    chart.push(value);
 }
+#endif
+
+#if MBED_CONF_APP_FRAME_SCHEDULER
+static FrameScheduler scheduler(std::chrono::microseconds(MBED_CONF_APP_FRAME_BUDGET_US));
 
-void draw_cross(lv_obj_t *canvas, uint8_t x, uint8_t y)
+/* Application work that must not wait for a whole frame */
+static void high_priority_work()
 {
-    uint8_t w = 20;
-    uint8_t h = 20;
+#if MBED_CONF_APP_DEMO_STREAM_CHART
+    chart.flush();
+#endif
+}
+#endif
 
-    const lv_point_t vertical[] = {{x, y - h / 2}, {x, y + h / 2}};
-    lv_draw_line_dsc_t line;
-    lv_draw_line_dsc_init(&line);
-    line.color = LV_COLOR_MAKE(255, 255, 255);
-    line.width = 2;
+#if MBED_CONF_APP_DEMO_BATCH_UPDATE
+/* Default stack size: the commit renders the frame in this thread */
+static Thread sensor_thread(osPriorityNormal, OS_STACK_SIZE, nullptr, "sensor");
+static lv_obj_t *sensor_labels[10];
 
-    lv_canvas_draw_line(canvas, vertical, 2, &line);
+/* Ten values per sensor packet, shown in one frame */
+static void sensor_loop()
+{
+    static UiBatch batch;
+    uint32_t packet = 0;
 
-    const lv_point_t horizontal[] = {{x - w / 2, y}, {x + w / 2, y}};
+    while (true) {
+        batch.begin_update();
+        for (int i = 0; i < 10; i++) {
+            char text[4];
+            snprintf(text, sizeof(text), "%lu", (unsigned long)((packet + i) % 10));
+            batch.set_text(sensor_labels[i], text);
+        }
+        batch.commit();
+        packet++;
+        ThisThread::sleep_for(500ms);
+    }
+}
+#endif
+
+/* Default stack size: the bus tuning prints from this thread */
+static Thread panel_thread(osPriorityAboveNormal, OS_STACK_SIZE, nullptr, "panel_init");
+#if MBED_CONF_APP_SCREEN_CACHE
+static bool splash_cached;
+#endif
 
-    lv_canvas_draw_line(canvas, horizontal, 2, &line);
+/* Panel side of the boot: the reset and sleep-out waits of the panels overlap
+ * the LVGL init and the screen construction in main() */
+static void panel_init()
+{
+    display.init();
+#if MBED_CONF_APP_SECOND_PANEL
+    second_display.init();
+#endif
+    boot_mark("panel_ready");
+
+#if MBED_CONF_APP_BUS_TUNING
+    /* The draw buffer is free: nothing is rendered before this thread ends */
+    if (tuner.init(&buf1[0].full, drawBufSize) != 0) {
+        printf("SPI bus tuning not verified or not stored\n");
+    }
+    printf("SPI bus: %lu Hz, %lu pixels per transfer\n",
+            (unsigned long)tuner.frequency(), (unsigned long)tuner.chunk_size());
+    boot_mark("bus_tuned");
+#endif
+
+#if MBED_CONF_APP_SCREEN_CACHE
+    splash_cached = screen_cache.init() == 0 && screen_cache.show(SPLASH_SLOT) == 0;
+    if (!splash_cached)
+#endif
+    {
+        boot_splash(&panel_io, screenWidth, screenHeight, &buf2[0].full,
+                lv_color_hex(0x1E3C72).full);
+    }
+    boot_mark(BOOT_FIRST_PIXEL);
 }
 
+#if MBED_CONF_APP_FAST_MEM
+/* From fast_mem.ld */
+extern uint32_t __fast_code_load;
+extern uint32_t __fast_code_start;
+extern uint32_t __fast_code_end;
+
+/* Copy the LV_ATTRIBUTE_FAST_MEM functions from flash to SRAM2 */
+static void fast_mem_init()
+{
+    memcpy(&__fast_code_start, &__fast_code_load,
+            (uint8_t *)&__fast_code_end - (uint8_t *)&__fast_code_start);
+    __DSB();
+    __ISB();
+
+    /* SRAM is non-executable by default in the MPU */
+    mbed_mpu_manager_lock_ram_execution();
+}
+#endif
+
 int main()
 {
     printf("Start App\n");
-    display.init();
+#if MBED_CONF_APP_FAST_MEM
+    fast_mem_init();
+#endif
+    boot_mark("main");
+    panel_thread.start(panel_init);
 
     lv_init();
-    lv_disp_draw_buf_init(&draw_buf, buf, NULL, screenWidth * 10);
+#if MBED_CONF_APP_BINARY_LOG
+    binary_log_start();
+#endif
+    bus.start();
 
     /*Initialize the display*/
-    static lv_disp_drv_t disp_drv;
-    lv_disp_drv_init(&disp_drv);
+    panel.register_display();
+#if MBED_CONF_APP_FLUSH_FILTER
+    panel.set_filter(&flush_filter);
+#endif
+#if MBED_CONF_APP_RGB444_FLUSH
+    panel.set_format_cb(callback(demo_format));
+#endif
+#if MBED_CONF_APP_SCREEN_MIRROR
+    panel.set_tee(callback(&mirror, &ScreenMirror::tee));
+#endif
+#if MBED_CONF_APP_SECOND_PANEL
+    second_panel.register_display();
+#endif
+
+#if MBED_CONF_APP_ASSET_FS
+    if (asset_fs.mount(&asset_bd) != 0) {
+        printf("Formatting asset file system\n");
+        asset_fs.reformat(&asset_bd);
+    }
+    lv_fs_mbed_init('F', &asset_fs);
+    rle_image_init();
+#endif
 
-    /*Change the following line to your display resolution*/
-    disp_drv.hor_res = screenWidth;
-    disp_drv.ver_res = screenHeight;
-    disp_drv.flush_cb = my_disp_flush;
-    disp_drv.draw_buf = &draw_buf;
-    lv_disp_drv_register(&disp_drv);
+    /* Screens are only rendered once the panels are ready */
+#if MBED_CONF_APP_DEMO_BATCH_UPDATE
+    create_dashboard_screen(lv_scr_act());
+    for (int i = 0; i < 10; i++) {
+        sensor_labels[i] = lv_obj_get_child(lv_obj_get_child(lv_scr_act(), i), 0);
+    }
+#else
+    create_crosses_screen(lv_scr_act());
+#endif
+#if MBED_CONF_APP_SECOND_PANEL
+    create_logo_screen(lv_disp_get_scr_act(second_panel.disp()));
+#endif
+    boot_mark("lvgl_ready");
+
+    panel_thread.join();
 
-    static lv_color_t cbuf[LV_CANVAS_BUF_SIZE_TRUE_COLOR(screenWidth, screenHeight)];
+#if MBED_CONF_APP_SCREEN_CACHE
+    if (!splash_cached) {
+        /* First boot: render the splash once, the next boots stream it from flash */
+        lv_obj_t *splash = lv_obj_create(NULL);
+        create_logo_screen(splash);
+        if (screen_cache.store(lv_disp_get_default(), splash, SPLASH_SLOT) == 0) {
+            screen_cache.show(SPLASH_SLOT);
+        }
+        lv_obj_del(splash);
+    }
+#endif
 
-    lv_obj_t *canvas = lv_canvas_create(lv_scr_act());
-    lv_canvas_set_buffer(canvas, cbuf, screenWidth, screenHeight, LV_IMG_CF_TRUE_COLOR);
+    /* First full frame, once its last area is on the panel */
+    lv_refr_now(NULL);
+    while (lv_disp_get_draw_buf(lv_disp_get_default())->flushing) {
+        ThisThread::yield();
+    }
+    boot_mark(BOOT_FIRST_FRAME);
+#if MBED_CONF_APP_BOOT_REPORT
+    boot_report();
+#endif
 
-    draw_cross(canvas, 10, 10);
+#if MBED_CONF_APP_BENCHMARK
+    bench_run(lv_disp_get_default());
+#endif
 
-    draw_cross(canvas, screenWidth - 10, 10);
+#if MBED_CONF_APP_DEMO_STREAM_CHART
+    lv_refr_now(NULL);
+    chart.clear();
+    sampler.attach(&sample_sensor, 10ms);
+#endif
 
-    draw_cross(canvas, 10, screenHeight - 10);
+#if MBED_CONF_APP_MEM_REPORT
+    /* LVGL heap after the first frame, for tools/mem_report.py */
+    lv_refr_now(NULL);
+    lv_mem_monitor_t mem;
+    lv_mem_monitor(&mem);
+    printf("MEM {\"lv_total\": %lu, \"lv_max_used\": %lu, \"lv_frag_pct\": %u}\n",
+            (unsigned long)mem.total_size, (unsigned long)mem.max_used, (unsigned)mem.frag_pct);
+#endif
 
-    draw_cross(canvas, screenWidth - 10, screenHeight - 10);
+#if MBED_CONF_APP_FRAME_SCHEDULER
+    scheduler.start(lv_disp_get_default());
+    scheduler.set_work(callback(high_priority_work));
+#endif
 
-    draw_cross(canvas, screenWidth / 2, screenHeight / 2);
+#if MBED_CONF_APP_DEMO_BATCH_UPDATE
+    sensor_thread.start(sensor_loop);
+#endif
 
     while (true)
     {
+        ui_lock();
+#if MBED_CONF_APP_FRAME_SCHEDULER
+        /* let the GUI do its work, within the budget */
+        std::chrono::milliseconds next(scheduler.handler());
+#else
         lv_timer_handler(); /* let the GUI do its work */
+#if MBED_CONF_APP_DEMO_STREAM_CHART
+        chart.flush();
+#endif
+#endif
+#if MBED_CONF_APP_SCREEN_MIRROR
+        mirror.poll(lv_disp_get_default());
+#endif
+        ui_unlock();
+#if MBED_CONF_APP_PANEL_STATS
+        static Kernel::Clock::time_point stats_time = Kernel::Clock::now();
+        if (Kernel::Clock::now() - stats_time >= 10s) {
+            stats_time = Kernel::Clock::now();
+            bus.print_stats();
+#if MBED_CONF_APP_FRAME_SCHEDULER
+            scheduler.print_report();
+#endif
+        }
+#endif
+#if MBED_CONF_APP_FRAME_SCHEDULER
+        /* Stripes still queued: no sleep */
+        if (next > 0ms) {
+            ThisThread::sleep_for(std::min<std::chrono::milliseconds>(next, 100ms));
+        }
+#else
         ThisThread::sleep_for(100ms);
+#endif
     }
     return 0;
 }
\ No newline at end of file
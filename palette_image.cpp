@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "palette_image.h"
+
+struct PaletteImage {
+    const uint8_t *rows;
+    uint32_t stride;
+    PaletteLut lut;
+};
+
+static uint8_t indexed_bpp(lv_img_cf_t cf)
+{
+    switch (cf) {
+        case LV_IMG_CF_INDEXED_1BIT:
+            return 1;
+        case LV_IMG_CF_INDEXED_2BIT:
+            return 2;
+        case LV_IMG_CF_INDEXED_4BIT:
+            return 4;
+        case LV_IMG_CF_INDEXED_8BIT:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+bool palette_lut_init(PaletteLut *lut, const lv_img_dsc_t *src)
+{
+    lut->bpp = indexed_bpp(src->header.cf);
+    if (!lut->bpp) {
+        return false;
+    }
+
+    const lv_color32_t *palette = (const lv_color32_t *)src->data;
+    uint32_t count = 1 << lut->bpp;
+    for (uint32_t i = 0; i < count; i++) {
+        lut->colors[i] = lv_color_make(palette[i].ch.red, palette[i].ch.green, palette[i].ch.blue);
+    }
+
+    /* Both pixels of a byte, the first one (high nibble) in the low half */
+    if (lut->bpp == 4) {
+        for (uint32_t i = 0; i < 256; i++) {
+            lut->pairs[i] = lut->colors[i >> 4].full | ((uint32_t)lut->colors[i & 0x0F].full << 16);
+        }
+    }
+
+    return true;
+}
+
+void palette_blit(lv_color_t *dst, const uint8_t *row, lv_coord_t x, lv_coord_t count,
+        const PaletteLut *lut)
+{
+    switch (lut->bpp) {
+        case 8:
+            row += x;
+            for (lv_coord_t i = 0; i < count; i++) {
+                dst[i] = lut->colors[row[i]];
+            }
+            break;
+        case 4:
+            row += x >> 1;
+            if ((x & 1) && count) {
+                *dst++ = lut->colors[*row++ & 0x0F];
+                count--;
+            }
+            /* One lookup and one (unaligned) word store per byte */
+            for (; count >= 2; count -= 2) {
+                memcpy(dst, &lut->pairs[*row++], sizeof(uint32_t));
+                dst += 2;
+            }
+            if (count) {
+                *dst = lut->colors[*row >> 4];
+            }
+            break;
+        default: {
+            uint8_t per_byte = 8 / lut->bpp;
+            uint8_t mask = (1 << lut->bpp) - 1;
+            for (lv_coord_t i = 0; i < count; i++) {
+                uint32_t px = x + i;
+                uint8_t shift = 8 - lut->bpp * (px % per_byte + 1);
+                dst[i] = lut->colors[(row[px / per_byte] >> shift) & mask];
+            }
+            break;
+        }
+    }
+}
+
+static void draw(PaletteImage *image, lv_obj_t *obj, const lv_area_t *clip)
+{
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+
+    lv_disp_draw_buf_t *draw_buf = lv_disp_get_draw_buf(_lv_refr_get_disp_refreshing());
+    const lv_area_t *buf_area = &draw_buf->area;
+    lv_area_t area;
+    if (!_lv_area_intersect(&area, &coords, clip) || !_lv_area_intersect(&area, &area, buf_area)) {
+        return;
+    }
+
+    lv_coord_t stride = lv_area_get_width(buf_area);
+    lv_coord_t n = lv_area_get_width(&area);
+    lv_coord_t x0 = area.x1 - coords.x1;
+    lv_color_t *dst = (lv_color_t *)draw_buf->buf_act
+            + (area.y1 - buf_area->y1) * stride + (area.x1 - buf_area->x1);
+
+    for (lv_coord_t y = area.y1 - coords.y1; y <= area.y2 - coords.y1; y++) {
+        palette_blit(dst, image->rows + y * image->stride, x0, n, &image->lut);
+        dst += stride;
+    }
+}
+
+static void event_cb(lv_event_t *e)
+{
+    PaletteImage *image = (PaletteImage *)lv_event_get_user_data(e);
+
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_DRAW_MAIN_BEGIN:
+            draw(image, lv_event_get_target(e), (const lv_area_t *)lv_event_get_param(e));
+            break;
+        case LV_EVENT_DELETE:
+            lv_mem_free(image);
+            break;
+        default:
+            break;
+    }
+}
+
+lv_obj_t *palette_image_create(lv_obj_t *parent, const lv_img_dsc_t *src)
+{
+    PaletteImage *image = (PaletteImage *)lv_mem_alloc(sizeof(PaletteImage));
+    if (!image) {
+        return nullptr;
+    }
+    if (!palette_lut_init(&image->lut, src)) {
+        lv_mem_free(image);
+        return nullptr;
+    }
+    image->rows = src->data + 4 * (1 << image->lut.bpp);
+    image->stride = (src->header.w * image->lut.bpp + 7) / 8;
+
+    /* A bare object, only the image is drawn */
+    lv_obj_t *obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, src->header.w, src->header.h);
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_event_cb(obj, event_cb, LV_EVENT_ALL, image);
+
+    return obj;
+}
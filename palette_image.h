@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef PALETTE_IMAGE_H
+#define PALETTE_IMAGE_H
+
+#include "lvgl.h"
+
+/**
+ * Palette of an indexed image, expanded to RGB565 once.
+ *
+ * For 4-bit images, each index byte also maps to its two pixels, so the
+ * blit writes two pixels per lookup.
+ */
+struct PaletteLut {
+    uint8_t bpp;
+    lv_color_t colors[256];
+    uint32_t pairs[256];
+};
+
+/* Fill lut from the palette at the start of an LV_IMG_CF_INDEXED_<n>BIT
+ * image. Return false for other formats */
+bool palette_lut_init(PaletteLut *lut, const lv_img_dsc_t *src);
+
+/* Expand count pixels of an image row, from pixel x, to RGB565 */
+void palette_blit(lv_color_t *dst, const uint8_t *row, lv_coord_t x, lv_coord_t count,
+        const PaletteLut *lut);
+
+/**
+ * Object showing an indexed image (tools/palette_convert.py) with
+ * palette_blit(), straight into the draw buffer.
+ *
+ * The image is opaque and drawn as is: the palette alpha, the image styles
+ * (opacity, recolor, zoom, angle) and the radius are ignored. Return
+ * nullptr if src is not indexed.
+ */
+lv_obj_t *palette_image_create(lv_obj_t *parent, const lv_img_dsc_t *src);
+
+#endif // PALETTE_IMAGE_H
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "panel.h"
+#include "pixel_pack.h"
+
+/* Bytes of count pixels on the bus */
+static uint32_t payload_size(uint32_t count, PanelIO::PixelFormat format)
+{
+    return format == PanelIO::PixelFormat::RGB444 ? rgb444_size(count) : count * sizeof(lv_color_t);
+}
+
+Panel::Panel(BusArbiter *bus, PanelIO *io, uint16_t width, uint16_t height,
+        lv_color_t *buf1, lv_color_t *buf2, uint32_t buf_pixels):
+    _bus(bus), _io(io), _disp(nullptr), _filter(nullptr), _transferring(false),
+    _stats()
+{
+    lv_disp_draw_buf_init(&_draw_buf, buf1, buf2, buf_pixels);
+
+    lv_disp_drv_init(&_drv);
+    _drv.hor_res = width;
+    _drv.ver_res = height;
+    _drv.flush_cb = flush_cb;
+    _drv.draw_buf = &_draw_buf;
+    _drv.user_data = this;
+
+    _bus->add(this);
+}
+
+lv_disp_t *Panel::register_display()
+{
+    _disp = lv_disp_drv_register(&_drv);
+    return _disp;
+}
+
+void Panel::flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
+{
+    Panel *panel = static_cast<Panel *>(drv->user_data);
+
+    if (panel->_tee) {
+        panel->_tee(drv, area, color_p);
+    }
+
+    PanelIO::PixelFormat format = PanelIO::PixelFormat::RGB565;
+    if (panel->_format_cb) {
+        format = panel->_format_cb(area);
+    }
+
+    panel->_stats.flushes++;
+    if (lv_disp_flush_is_last(drv)) {
+        panel->_stats.frames++;
+    }
+
+    panel->_bus->submit(panel, area, color_p, format);
+}
+
+void Panel::set_filter(FlushFilter *filter)
+{
+    _filter = filter;
+    _io->set_window_cb(filter ? callback(this, &Panel::window_opened) : nullptr);
+}
+
+void Panel::window_opened(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+    /* The windows of transfer() are the rows the filter just recorded */
+    if (!_transferring) {
+        _filter->invalidate(y1, y2);
+    }
+}
+
+void Panel::transfer(const lv_area_t *area, lv_color_t *pixels, PanelIO::PixelFormat format)
+{
+    if (!_filter) {
+        send(area, pixels, format);
+        return;
+    }
+
+    _transferring = true;
+
+    /* Runs of changed rows are sent in narrowed windows */
+    lv_coord_t w = lv_area_get_width(area);
+    lv_area_t run = *area;
+    bool in_run = false;
+
+    for (lv_coord_t y = area->y1; y <= area->y2; y++) {
+        lv_color_t *row = pixels + (y - area->y1) * w;
+        if (_filter->row_changed(y, area->x1, area->x2, row)) {
+            if (!in_run) {
+                run.y1 = y;
+                in_run = true;
+            }
+            continue;
+        }
+
+        if (in_run) {
+            run.y2 = y - 1;
+            send(&run, pixels + (run.y1 - area->y1) * w, format);
+            in_run = false;
+        }
+        _stats.skipped_bytes += payload_size(w, format);
+    }
+
+    if (in_run) {
+        run.y2 = area->y2;
+        send(&run, pixels + (run.y1 - area->y1) * w, format);
+    }
+    _transferring = false;
+}
+
+void Panel::send(const lv_area_t *area, lv_color_t *pixels, PanelIO::PixelFormat format)
+{
+    uint32_t size = lv_area_get_size(area);
+
+    _stats.bytes += _io->set_window(area->x1, area->y1, area->x2, area->y2, format);
+    _stats.bytes += payload_size(size, format);
+    if (format == PanelIO::PixelFormat::RGB444) {
+        /* LVGL is done with the buffer once flushed: pack it in place. The
+         * rows after the area are left as they are */
+        uint8_t *packed = (uint8_t *)pixels;
+        _io->write_packed_async(packed, pack_rgb444(packed, &pixels->full, size));
+    } else {
+        _io->write_pixels_async(&pixels->full, size);
+    }
+}
+
+BusArbiter::BusArbiter():
+    _thread(osPriorityAboveNormal, BUS_ARBITER_STACK_SIZE, nullptr, "bus_arbiter"),
+    _panel_count(0)
+{
+}
+
+void BusArbiter::start()
+{
+    _timer.start();
+    _thread.start(callback(this, &BusArbiter::worker));
+}
+
+void BusArbiter::add(Panel *panel)
+{
+    MBED_ASSERT(_panel_count < BUS_ARBITER_MAX_PANELS);
+    _panels[_panel_count++] = panel;
+}
+
+void BusArbiter::submit(Panel *panel, const lv_area_t *area, lv_color_t *pixels,
+        PanelIO::PixelFormat format)
+{
+    /* LVGL waits for a flush to be done before the next one of the same
+     * panel: there is always a free job */
+    Job *job = _jobs.try_alloc();
+    MBED_ASSERT(job);
+
+    job->panel = panel;
+    job->area = *area;
+    job->pixels = pixels;
+    job->format = format;
+    _jobs.put(job);
+}
+
+void BusArbiter::worker()
+{
+    while (true) {
+        Job *job = _jobs.try_get_for(Kernel::wait_for_u32_forever);
+        Panel *panel = job->panel;
+
+        std::chrono::microseconds start = _timer.elapsed_time();
+        panel->_io->lock();
+        panel->transfer(&job->area, job->pixels, job->format);
+        panel->_io->unlock();
+        panel->_stats.bus_time += _timer.elapsed_time() - start;
+
+        _jobs.free(job);
+        lv_disp_flush_ready(&panel->_drv);
+    }
+}
+
+void BusArbiter::print_stats()
+{
+    std::chrono::microseconds elapsed = _timer.elapsed_time();
+    std::chrono::microseconds busy = 0us;
+    _timer.reset();
+
+    if (elapsed.count() <= 0) {
+        return;
+    }
+
+    for (size_t i = 0; i < _panel_count; i++) {
+        PanelStats stats = _panels[i]->stats();
+        PanelIO *io = _panels[i]->io();
+        _panels[i]->reset_stats();
+        busy += stats.bus_time;
+
+        /* Fixed point: no float support in the minimal printf */
+        printf("panel %u: %lu.%lu fps, %lu flushes, %lu bytes, %lu skipped, "
+                "window %lu bytes, %lu saved, bus %lu%%\n",
+                (unsigned)i,
+                (unsigned long)(stats.frames * 10000000ULL / elapsed.count() / 10),
+                (unsigned long)(stats.frames * 10000000ULL / elapsed.count() % 10),
+                (unsigned long)stats.flushes,
+                (unsigned long)stats.bytes,
+                (unsigned long)stats.skipped_bytes,
+                (unsigned long)io->window_bytes(),
+                (unsigned long)io->saved_window_bytes(),
+                (unsigned long)(stats.bus_time.count() * 100 / elapsed.count()));
+        io->reset_window_counters();
+    }
+    printf("bus: %lu%% busy\n", (unsigned long)(busy.count() * 100 / elapsed.count()));
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef PANEL_H
+#define PANEL_H
+
+#include "mbed.h"
+#include "lvgl.h"
+#include "panel_io.h"
+#include "flush_filter.h"
+
+/* Panels sharing one bus */
+#ifndef BUS_ARBITER_MAX_PANELS
+#define BUS_ARBITER_MAX_PANELS 4
+#endif
+
+#ifndef BUS_ARBITER_STACK_SIZE
+#define BUS_ARBITER_STACK_SIZE 1024
+#endif
+
+class BusArbiter;
+
+typedef mbed::Callback<void(lv_disp_drv_t *, const lv_area_t *, const lv_color_t *)> panel_tee_t;
+
+/* Interface format of a flushed area */
+typedef mbed::Callback<PanelIO::PixelFormat(const lv_area_t *)> panel_format_cb_t;
+
+struct PanelStats {
+    uint32_t frames;
+    uint32_t flushes;
+    uint32_t bytes;
+    uint32_t skipped_bytes; /* left out by the flush filter */
+    std::chrono::microseconds bus_time;
+};
+
+/**
+ * One ILI9163C panel registered as an LVGL display.
+ *
+ * With two draw buffers, the flush of a stripe is handed to the bus arbiter
+ * and LVGL renders the next stripe, or the next panel, during the transfer.
+ */
+class Panel {
+public:
+    Panel(BusArbiter *bus, PanelIO *io, uint16_t width, uint16_t height,
+            lv_color_t *buf1, lv_color_t *buf2, uint32_t buf_pixels);
+
+    /* Register the LVGL display, the first registered one is the default */
+    lv_disp_t *register_display();
+
+    /* Called with every flushed area while its pixels are valid */
+    void set_tee(panel_tee_t tee)
+    {
+        _tee = tee;
+    }
+
+    /* Select the format of each flushed area, RGB565 for all without it.
+     * RGB444 areas are packed in the draw buffer and take 25% less bus time */
+    void set_format_cb(panel_format_cb_t format_cb)
+    {
+        _format_cb = format_cb;
+    }
+
+    /* Send only the rows that changed since they were last sent. Windows
+     * opened on the PanelIO outside of the flushes of this panel (stream
+     * chart, screen cache...) invalidate their rows in the filter */
+    void set_filter(FlushFilter *filter);
+
+    lv_disp_t *disp()
+    {
+        return _disp;
+    }
+
+    PanelIO *io()
+    {
+        return _io;
+    }
+
+    PanelStats stats() const
+    {
+        return _stats;
+    }
+
+    void reset_stats()
+    {
+        _stats = {};
+    }
+
+private:
+    friend class BusArbiter;
+
+    static void flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p);
+    void transfer(const lv_area_t *area, lv_color_t *pixels, PanelIO::PixelFormat format);
+    void send(const lv_area_t *area, lv_color_t *pixels, PanelIO::PixelFormat format);
+    void window_opened(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+
+    BusArbiter *_bus;
+    PanelIO *_io;
+    lv_disp_draw_buf_t _draw_buf;
+    lv_disp_drv_t _drv;
+    lv_disp_t *_disp;
+    panel_tee_t _tee;
+    panel_format_cb_t _format_cb;
+    FlushFilter *_filter;
+    bool _transferring;
+    PanelStats _stats;
+};
+
+/**
+ * Scheduler of the flushes of the panels of one SPI bus.
+ *
+ * Flushes are queued by the LVGL thread and run in order by a worker thread,
+ * which sleeps during the pixel transfers. The bus is locked for the whole
+ * flush: code writing to a panel outside of LVGL locks it through PanelIO.
+ */
+class BusArbiter {
+public:
+    BusArbiter();
+
+    void start();
+
+    /* Print the frame rate and the bus share of every panel since the last call */
+    void print_stats();
+
+private:
+    friend class Panel;
+
+    struct Job {
+        Panel *panel;
+        lv_area_t area;
+        lv_color_t *pixels;
+        PanelIO::PixelFormat format;
+    };
+
+    void add(Panel *panel);
+    void submit(Panel *panel, const lv_area_t *area, lv_color_t *pixels,
+            PanelIO::PixelFormat format);
+    void worker();
+
+    Thread _thread;
+    Mail<Job, BUS_ARBITER_MAX_PANELS> _jobs;
+    Panel *_panels[BUS_ARBITER_MAX_PANELS];
+    size_t _panel_count;
+    Timer _timer;
+};
+
+#endif // PANEL_H
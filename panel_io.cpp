@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "panel_io.h"
+
+using namespace sixtron;
+
+PanelIO::PanelIO(ILI9163C *display, SPI *spi, PinName cs, PinName dc):
+    _display(display), _spi(spi), _cs(cs, 1), _dc(dc, 1), _chunk(PANEL_IO_CHUNK_PIXELS),
+    _format(PixelFormat::RGB565), _window(), _window_valid(false), _window_bytes(0),
+    _saved_window_bytes(0)
+{
+}
+
+uint32_t PanelIO::set_window(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, PixelFormat format)
+{
+    const uint8_t columns[] = {(uint8_t)(x1 >> 8), (uint8_t)x1, (uint8_t)(x2 >> 8), (uint8_t)x2};
+    const uint8_t rows[] = {(uint8_t)(y1 >> 8), (uint8_t)y1, (uint8_t)(y2 >> 8), (uint8_t)y2};
+    bool same_columns = _window_valid && _window[0] == x1 && _window[2] == x2;
+    bool same_rows = _window_valid && _window[1] == y1 && _window[3] == y2;
+    uint32_t sent = 0;
+
+    _spi->lock();
+    _cs = 0;
+    /* COLMOD ends a memory write: it goes before the window */
+    if (format != _format) {
+        const uint8_t param = (uint8_t)format;
+        sent += send_command(ili9163c_cmd::COLMOD, &param, 1);
+        _format = format;
+    }
+    if (!same_columns) {
+        sent += send_command(ili9163c_cmd::CASET, columns, sizeof(columns));
+    }
+    if (!same_rows) {
+        sent += send_command(ili9163c_cmd::RASET, rows, sizeof(rows));
+    }
+    /* Always sent: it moves the write pointer back to the window start */
+    sent += send_command(ili9163c_cmd::RAMWR, nullptr, 0);
+    _cs = 1;
+    if (_window_cb) {
+        _window_cb(x1, y1, x2, y2);
+    }
+    _spi->unlock();
+
+    _window[0] = x1;
+    _window[1] = y1;
+    _window[2] = x2;
+    _window[3] = y2;
+    _window_valid = true;
+    _window_bytes += sent;
+    _saved_window_bytes += (same_columns ? 1 + sizeof(columns) : 0) + (same_rows ? 1 + sizeof(rows) : 0);
+
+    return sent;
+}
+
+void PanelIO::write_pixels(uint16_t *data, uint32_t count)
+{
+    while (count) {
+        uint32_t n = (_chunk && count > _chunk) ? _chunk : count;
+        _display->write_data_16(data, n);
+        data += n;
+        count -= n;
+    }
+}
+
+void PanelIO::write_pixels_async(uint16_t *data, uint32_t count)
+{
+#if DEVICE_SPI_ASYNCH
+    /* 16-bit frames go out MSB first: the panel byte order for RGB565 */
+    transfer(data, count);
+#else
+    write_pixels(data, count);
+#endif
+}
+
+void PanelIO::write_packed_async(const uint8_t *data, uint32_t len)
+{
+#if DEVICE_SPI_ASYNCH
+    transfer(data, len);
+#else
+    _spi->lock();
+    _dc = 1;
+    _cs = 0;
+    _spi->write(reinterpret_cast<const char *>(data), len, nullptr, 0);
+    _cs = 1;
+    _spi->unlock();
+#endif
+}
+
+#if DEVICE_SPI_ASYNCH
+template <typename W>
+void PanelIO::transfer(const W *data, uint32_t count)
+{
+    /* The chunk size is in RGB565 pixels */
+    uint32_t chunk = _chunk * sizeof(uint16_t) / sizeof(W);
+
+    _spi->lock();
+    _spi->format(sizeof(W) * 8, 0);
+    _dc = 1;
+    _cs = 0;
+    while (count) {
+        uint32_t n = (chunk && count > chunk) ? chunk : count;
+        _spi->transfer(data, n * sizeof(W), (W *)NULL, 0,
+                callback(this, &PanelIO::transfer_done), SPI_EVENT_COMPLETE);
+        _transfer.acquire();
+        data += n;
+        count -= n;
+    }
+    _cs = 1;
+    _spi->format(8, 0);
+    _spi->unlock();
+}
+#endif
+
+void PanelIO::transfer_done(int event)
+{
+    _transfer.release();
+}
+
+void PanelIO::command(uint8_t cmd, const uint8_t *params, size_t len)
+{
+    _spi->lock();
+    _cs = 0;
+    send_command(cmd, params, len);
+    _cs = 1;
+    if (cmd == ili9163c_cmd::SWRESET) {
+        _window_valid = false;
+    }
+    _spi->unlock();
+}
+
+/* One command and its parameters, chip select already asserted */
+uint32_t PanelIO::send_command(uint8_t cmd, const uint8_t *params, size_t len)
+{
+    _dc = 0;
+    _spi->write(cmd);
+    if (len) {
+        _dc = 1;
+        _spi->write(reinterpret_cast<const char *>(params), len, nullptr, 0);
+    }
+
+    return 1 + len;
+}
+
+void PanelIO::read(uint8_t cmd, uint8_t *data, size_t len)
+{
+    _spi->lock();
+    _cs = 0;
+    _dc = 0;
+    _spi->write(cmd);
+    _dc = 1;
+    _spi->write(0x00); /* dummy cycle */
+    for (size_t i = 0; i < len; i++) {
+        data[i] = _spi->write(0x00);
+    }
+    _cs = 1;
+    _spi->unlock();
+}
+
+void PanelIO::set_scroll_area(uint16_t top, uint16_t height)
+{
+    uint16_t bottom = PANEL_IO_MEMORY_LINES - top - height;
+    const uint8_t params[] = {
+        (uint8_t)(top >> 8), (uint8_t)top,
+        (uint8_t)(height >> 8), (uint8_t)height,
+        (uint8_t)(bottom >> 8), (uint8_t)bottom,
+    };
+
+    command(ili9163c_cmd::VSCRDEF, params, sizeof(params));
+}
+
+void PanelIO::scroll_to(uint16_t line)
+{
+    const uint8_t params[] = {(uint8_t)(line >> 8), (uint8_t)line};
+
+    command(ili9163c_cmd::VSCRSADD, params, sizeof(params));
+}
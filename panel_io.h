@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef PANEL_IO_H
+#define PANEL_IO_H
+
+#include "mbed.h"
+#include "ili9163c.h"
+
+/* Number of lines of the panel frame memory (GM setting of the ILI9163C) */
+#ifndef PANEL_IO_MEMORY_LINES
+#define PANEL_IO_MEMORY_LINES 160
+#endif
+
+/* Default number of pixels per SPI transfer, 0 to send each write at once */
+#ifndef PANEL_IO_CHUNK_PIXELS
+#define PANEL_IO_CHUNK_PIXELS 0
+#endif
+
+/* ILI9163C commands issued outside of the driver */
+namespace ili9163c_cmd {
+enum : uint8_t {
+    SWRESET = 0x01,
+    RDDID = 0x04,
+    RDDST = 0x09,
+    SLPOUT = 0x11,
+    NORON = 0x13,
+    DISPON = 0x29,
+    CASET = 0x2A,
+    RASET = 0x2B,
+    RAMWR = 0x2C,
+    RAMRD = 0x2E,
+    VSCRDEF = 0x33,
+    MADCTL = 0x36,
+    VSCRSADD = 0x37,
+    COLMOD = 0x3A,
+};
+}
+
+/* Window opened on the panel, frame memory coordinates */
+typedef mbed::Callback<void(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)> panel_window_cb_t;
+
+/**
+ * Access path to an ILI9163C panel.
+ *
+ * Pixel data go through the driver. Windows and raw commands (scrolling,
+ * register reads...) are clocked here on the same bus, CS and D/C lines; the
+ * windows are in frame memory coordinates, the panel has no offset in it.
+ */
+class PanelIO {
+public:
+    /* Interface pixel formats, values of the COLMOD parameter */
+    enum class PixelFormat : uint8_t {
+        RGB444 = 0x03,
+        RGB565 = 0x05,
+    };
+
+    PanelIO(sixtron::ILI9163C *display, SPI *spi, PinName cs, PinName dc);
+
+    /* Open a frame memory window, the following pixels are written into it
+     * in format. The column and row ranges are only sent when they changed,
+     * all the commands under one chip select. Return the command and
+     * parameter bytes sent */
+    uint32_t set_window(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+            PixelFormat format = PixelFormat::RGB565);
+
+    /* Called by set_window() with each window, bus locked: the pixels
+     * written into it change what the panel shows */
+    void set_window_cb(panel_window_cb_t window_cb)
+    {
+        _window_cb = window_cb;
+    }
+
+    /* Window command and parameter bytes sent, and left out because the
+     * panel already had the same column or row range */
+    uint32_t window_bytes() const
+    {
+        return _window_bytes;
+    }
+
+    uint32_t saved_window_bytes() const
+    {
+        return _saved_window_bytes;
+    }
+
+    void reset_window_counters()
+    {
+        _window_bytes = 0;
+        _saved_window_bytes = 0;
+    }
+
+    /* Write RGB565 pixels into the current window */
+    void write_pixels(uint16_t *data, uint32_t count);
+
+    /* Same as write_pixels(), but the calling thread sleeps during the transfer
+     * so that other threads can run. Blocking on targets without asynchronous SPI */
+    void write_pixels_async(uint16_t *data, uint32_t count);
+
+    /* Write pixels packed by pack_rgb444() into an RGB444 window, asynchronous
+     * like write_pixels_async() */
+    void write_packed_async(const uint8_t *data, uint32_t len);
+
+    /* Split the pixel writes into transfers of at most pixels, 0 for no limit */
+    void set_chunk_size(uint32_t pixels)
+    {
+        _chunk = pixels;
+    }
+
+    uint32_t chunk_size() const
+    {
+        return _chunk;
+    }
+
+    /* SPI clock of the bus, shared by all the panels on it */
+    void set_frequency(int hz)
+    {
+        _spi->frequency(hz);
+    }
+
+    /* Reserve the bus for a sequence of calls (window then pixels...) */
+    void lock()
+    {
+        _spi->lock();
+    }
+
+    void unlock()
+    {
+        _spi->unlock();
+    }
+
+    /* Send a command followed by its parameters */
+    void command(uint8_t cmd, const uint8_t *params = nullptr, size_t len = 0);
+
+    /* Send a read command and collect its answer, after the dummy cycle */
+    void read(uint8_t cmd, uint8_t *data, size_t len);
+
+    /* Define the vertical scrolling area, lines outside of it stay fixed */
+    void set_scroll_area(uint16_t top, uint16_t height);
+
+    /* Select the frame memory line shown at the top of the scrolling area */
+    void scroll_to(uint16_t line);
+
+    sixtron::ILI9163C *display()
+    {
+        return _display;
+    }
+
+private:
+    uint32_t send_command(uint8_t cmd, const uint8_t *params, size_t len);
+    void transfer_done(int event);
+
+#if DEVICE_SPI_ASYNCH
+    template <typename W>
+    void transfer(const W *data, uint32_t count);
+#endif
+
+    sixtron::ILI9163C *_display;
+    SPI *_spi;
+    DigitalOut _cs;
+    DigitalOut _dc;
+    Semaphore _transfer;
+    uint32_t _chunk;
+    PixelFormat _format;
+    panel_window_cb_t _window_cb;
+
+    /* Column and row ranges of the panel, invalid until the first window
+     * and after a software reset */
+    uint16_t _window[4];
+    bool _window_valid;
+    uint32_t _window_bytes;
+    uint32_t _saved_window_bytes;
+};
+
+#endif // PANEL_IO_H
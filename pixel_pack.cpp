@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "pixel_pack.h"
+
+/* 4 upper bits of each component, as 0x0RGB */
+static inline uint32_t to_rgb444(uint32_t c)
+{
+    return ((c >> 4) & 0xF00) | ((c >> 3) & 0x0F0) | ((c >> 1) & 0x00F);
+}
+
+uint32_t pack_rgb444(uint8_t *dst, const uint16_t *src, uint32_t count)
+{
+    uint8_t *out = dst;
+    uint32_t pairs = count / 2;
+
+    /* Both pixels of a pair are read before its 3 bytes are written, which
+     * never reach the next pair: safe in place */
+    while (pairs >= 2) {
+        uint32_t a = to_rgb444(src[0]);
+        uint32_t b = to_rgb444(src[1]);
+        uint32_t c = to_rgb444(src[2]);
+        uint32_t d = to_rgb444(src[3]);
+        out[0] = a >> 4;
+        out[1] = (a << 4) | (b >> 8);
+        out[2] = b;
+        out[3] = c >> 4;
+        out[4] = (c << 4) | (d >> 8);
+        out[5] = d;
+        src += 4;
+        out += 6;
+        pairs -= 2;
+    }
+
+    if (pairs) {
+        uint32_t a = to_rgb444(src[0]);
+        uint32_t b = to_rgb444(src[1]);
+        out[0] = a >> 4;
+        out[1] = (a << 4) | (b >> 8);
+        out[2] = b;
+        src += 2;
+        out += 3;
+    }
+
+    /* Last odd pixel: its unused low nibble is ignored by the panel */
+    if (count & 1) {
+        uint32_t a = to_rgb444(src[0]);
+        out[0] = a >> 4;
+        out[1] = a << 4;
+        out += 2;
+    }
+
+    return out - dst;
+}
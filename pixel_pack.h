@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef PIXEL_PACK_H
+#define PIXEL_PACK_H
+
+#include <stdint.h>
+
+/* Bytes taken by count RGB444 pixels: 3 bytes per pair, 2 for a last odd one */
+static inline uint32_t rgb444_size(uint32_t count)
+{
+    return (count / 2) * 3 + (count & 1) * 2;
+}
+
+/**
+ * Pack RGB565 pixels to RGB444, two pixels in three bytes, in the order of
+ * the 12-bit ILI9163C interface (R0G0 B0R1 G1B1).
+ *
+ * dst may be the same buffer as src: the packing is done in place.
+ * Return the number of bytes written.
+ */
+uint32_t pack_rgb444(uint8_t *dst, const uint16_t *src, uint32_t count);
+
+#endif // PIXEL_PACK_H
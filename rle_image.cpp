@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "rle_image.h"
+
+#define RLI_HEADER_SIZE 8
+
+/* Worst case of a row: literal pixels only, one token each */
+#define RLI_MAX_PACKED_ROW(width) ((width) * 3)
+
+struct RleImage {
+    lv_fs_file_t file;
+    uint16_t width;
+    uint16_t height;
+    lv_coord_t row;      /* row decoded in line, -1 if none */
+    uint32_t *offsets;   /* height + 1 row offsets */
+    uint8_t *packed;
+    lv_color_t *line;
+};
+
+static bool is_rli(const void *src)
+{
+    if (lv_img_src_get_type(src) != LV_IMG_SRC_FILE) {
+        return false;
+    }
+
+    const char *ext = strrchr(static_cast<const char *>(src), '.');
+    return ext && strcmp(ext, ".rli") == 0;
+}
+
+static bool read_header(lv_fs_file_t *file, uint16_t *width, uint16_t *height)
+{
+    uint8_t header[RLI_HEADER_SIZE];
+    uint32_t count;
+
+    if (lv_fs_read(file, header, sizeof(header), &count) != LV_FS_RES_OK
+            || count != sizeof(header) || memcmp(header, "RLI1", 4) != 0) {
+        return false;
+    }
+
+    *width = header[4] | (header[5] << 8);
+    *height = header[6] | (header[7] << 8);
+
+    return true;
+}
+
+static lv_res_t rle_info(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header)
+{
+    if (!is_rli(src)) {
+        return LV_RES_INV;
+    }
+
+    lv_fs_file_t file;
+    if (lv_fs_open(&file, static_cast<const char *>(src), LV_FS_MODE_RD) != LV_FS_RES_OK) {
+        return LV_RES_INV;
+    }
+
+    uint16_t width, height;
+    bool valid = read_header(&file, &width, &height);
+    lv_fs_close(&file);
+    if (!valid) {
+        return LV_RES_INV;
+    }
+
+    header->cf = LV_IMG_CF_TRUE_COLOR;
+    header->always_zero = 0;
+    header->w = width;
+    header->h = height;
+
+    return LV_RES_OK;
+}
+
+static void rle_close(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+    RleImage *image = static_cast<RleImage *>(dsc->user_data);
+    if (!image) {
+        return;
+    }
+
+    lv_fs_close(&image->file);
+    lv_mem_free(image->offsets);
+    lv_mem_free(image->packed);
+    lv_mem_free(image->line);
+    lv_mem_free(image);
+    dsc->user_data = NULL;
+}
+
+static lv_res_t rle_open(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+    if (!is_rli(dsc->src)) {
+        return LV_RES_INV;
+    }
+
+    RleImage *image = static_cast<RleImage *>(lv_mem_alloc(sizeof(RleImage)));
+    if (!image) {
+        return LV_RES_INV;
+    }
+    memset(image, 0, sizeof(RleImage));
+    image->row = -1;
+
+    if (lv_fs_open(&image->file, static_cast<const char *>(dsc->src), LV_FS_MODE_RD) != LV_FS_RES_OK) {
+        lv_mem_free(image);
+        return LV_RES_INV;
+    }
+    dsc->user_data = image;
+
+    if (!read_header(&image->file, &image->width, &image->height)) {
+        rle_close(decoder, dsc);
+        return LV_RES_INV;
+    }
+
+    uint32_t table_size = (image->height + 1) * sizeof(uint32_t);
+    uint32_t count;
+    image->offsets = static_cast<uint32_t *>(lv_mem_alloc(table_size));
+    image->packed = static_cast<uint8_t *>(lv_mem_alloc(RLI_MAX_PACKED_ROW(image->width)));
+    image->line = static_cast<lv_color_t *>(lv_mem_alloc(image->width * sizeof(lv_color_t)));
+    if (!image->offsets || !image->packed || !image->line
+            || lv_fs_read(&image->file, image->offsets, table_size, &count) != LV_FS_RES_OK
+            || count != table_size) {
+        rle_close(decoder, dsc);
+        return LV_RES_INV;
+    }
+
+    /* Rows are decoded on demand by rle_read_line() */
+    dsc->img_data = NULL;
+
+    return LV_RES_OK;
+}
+
+static bool decode_row(RleImage *image, lv_coord_t y)
+{
+    uint32_t size = image->offsets[y + 1] - image->offsets[y];
+    uint32_t count;
+
+    if (size > RLI_MAX_PACKED_ROW(image->width)
+            || lv_fs_seek(&image->file, image->offsets[y], LV_FS_SEEK_SET) != LV_FS_RES_OK
+            || lv_fs_read(&image->file, image->packed, size, &count) != LV_FS_RES_OK
+            || count != size) {
+        return false;
+    }
+
+    /* line is overwritten from here on */
+    image->row = -1;
+
+    const uint8_t *src = image->packed;
+    const uint8_t *end = src + size;
+    uint16_t x = 0;
+
+    while (src < end && x < image->width) {
+        uint8_t token = *src++;
+        uint16_t n = (token & 0x7F) + 1;
+        if (x + n > image->width) {
+            return false;
+        }
+
+        /* A token must not read past the packed row */
+        uint32_t token_size = (token & 0x80) ? sizeof(lv_color_t) : n * sizeof(lv_color_t);
+        if (token_size > (uint32_t)(end - src)) {
+            return false;
+        }
+
+        if (token & 0x80) {
+            lv_color_t color;
+            color.full = src[0] | (src[1] << 8);
+            src += 2;
+            while (n--) {
+                image->line[x++] = color;
+            }
+        } else {
+            memcpy(&image->line[x], src, n * sizeof(lv_color_t));
+            src += n * sizeof(lv_color_t);
+            x += n;
+        }
+    }
+
+    image->row = (x == image->width) ? y : -1;
+    return image->row == y;
+}
+
+static lv_res_t rle_read_line(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc,
+        lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t *buf)
+{
+    RleImage *image = static_cast<RleImage *>(dsc->user_data);
+
+    if (y != image->row && !decode_row(image, y)) {
+        return LV_RES_INV;
+    }
+
+    memcpy(buf, &image->line[x], len * sizeof(lv_color_t));
+
+    return LV_RES_OK;
+}
+
+void rle_image_init()
+{
+    lv_img_decoder_t *decoder = lv_img_decoder_create();
+
+    lv_img_decoder_set_info_cb(decoder, rle_info);
+    lv_img_decoder_set_open_cb(decoder, rle_open);
+    lv_img_decoder_set_read_line_cb(decoder, rle_read_line);
+    lv_img_decoder_set_close_cb(decoder, rle_close);
+}
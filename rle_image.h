@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef RLE_IMAGE_H
+#define RLE_IMAGE_H
+
+#include "lvgl.h"
+
+/**
+ * LVGL image decoder for run-length encoded RGB565 files (".rli").
+ *
+ * File layout, little endian:
+ * - "RLI1", width (16-bit), height (16-bit)
+ * - offset of each row from the start of the file, then the file size (32-bit)
+ * - rows: 0x80 | (n - 1) followed by a pixel repeats it n times,
+ *   n - 1 followed by n pixels copies them (n <= 128)
+ *
+ * Only the rows being drawn are read and decoded, with one file read per row
+ * and a single decoded row kept in RAM. Files are made by tools/rli_convert.py.
+ */
+void rle_image_init();
+
+#endif // RLE_IMAGE_H
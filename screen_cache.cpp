@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "screen_cache.h"
+
+#define SCREEN_CACHE_MAGIC 0x53435243 /* "CRCS" */
+
+typedef void (*flush_cb_t)(lv_disp_drv_t *, const lv_area_t *, lv_color_t *);
+
+/* Cache being programmed by capture_flush() */
+static ScreenCache *capturing;
+
+static bd_size_t align_up(bd_size_t value, bd_size_t alignment)
+{
+    return ((value + alignment - 1) / alignment) * alignment;
+}
+
+ScreenCache::ScreenCache(BlockDevice *bd, PanelIO *panel, uint16_t width, uint16_t height):
+    _bd(bd),
+    _panel(panel),
+    _width(width),
+    _height(height),
+    _slot_size(0),
+    _write_addr(0),
+    _chunk_fill(0),
+    _next_row(0),
+    _capture_error(ERROR_OK)
+{
+}
+
+int ScreenCache::init()
+{
+    int err = _bd->init();
+    if (err) {
+        return err;
+    }
+
+    MBED_ASSERT(SCREEN_CACHE_CHUNK_SIZE % _bd->get_program_size() == 0);
+    MBED_ASSERT(SCREEN_CACHE_CHUNK_SIZE % _bd->get_read_size() == 0);
+    MBED_ASSERT(frame_offset() <= SCREEN_CACHE_CHUNK_SIZE);
+
+    bd_size_t frame_size = (bd_size_t)_width * _height * sizeof(uint16_t);
+    _slot_size = align_up(frame_offset() + frame_size, _bd->get_erase_size());
+
+    return ERROR_OK;
+}
+
+uint32_t ScreenCache::slots() const
+{
+    return _slot_size ? _bd->size() / _slot_size : 0;
+}
+
+bool ScreenCache::contains(uint32_t slot)
+{
+    if (slot >= slots()) {
+        return false;
+    }
+
+    Header header;
+    if (_bd->read(_chunk, slot * _slot_size, align_up(sizeof(header), _bd->get_read_size()))) {
+        return false;
+    }
+    memcpy(&header, _chunk, sizeof(header));
+
+    return header.magic == SCREEN_CACHE_MAGIC && header.width == _width && header.height == _height;
+}
+
+int ScreenCache::store(lv_disp_t *disp, lv_obj_t *scr, uint32_t slot)
+{
+    if (slot >= slots()) {
+        return ERROR_BAD_SLOT;
+    }
+
+    bd_addr_t slot_addr = slot * _slot_size;
+    int err = _bd->erase(slot_addr, _slot_size);
+    if (err) {
+        return err;
+    }
+
+    _write_addr = slot_addr + frame_offset();
+    _chunk_fill = 0;
+    _next_row = 0;
+    _capture_error = ERROR_OK;
+
+    /* Render the whole screen into the block device instead of the panel */
+    lv_obj_t *previous = lv_disp_get_scr_act(disp);
+    flush_cb_t target_flush = disp->driver->flush_cb;
+    capturing = this;
+    disp->driver->flush_cb = capture_flush;
+
+    lv_disp_load_scr(scr);
+    lv_obj_invalidate(scr);
+    lv_refr_now(disp);
+
+    disp->driver->flush_cb = target_flush;
+    capturing = nullptr;
+    lv_disp_load_scr(previous);
+    lv_obj_invalidate(previous);
+
+    if (_capture_error == ERROR_OK && _chunk_fill) {
+        _capture_error = flush_chunk();
+    }
+    if (_capture_error == ERROR_OK && _next_row != _height) {
+        _capture_error = ERROR_BAD_AREA;
+    }
+    if (_capture_error != ERROR_OK) {
+        return _capture_error;
+    }
+
+    /* The header is programmed last: an interrupted store leaves an empty slot */
+    Header header = {SCREEN_CACHE_MAGIC, _width, _height};
+    memset(_chunk, 0xFF, frame_offset());
+    memcpy(_chunk, &header, sizeof(header));
+
+    return _bd->program(_chunk, slot_addr, frame_offset());
+}
+
+int ScreenCache::show(uint32_t slot)
+{
+    if (!contains(slot)) {
+        return ERROR_EMPTY_SLOT;
+    }
+
+    bd_addr_t addr = slot * _slot_size + frame_offset();
+    uint32_t remaining = (uint32_t)_width * _height * sizeof(uint16_t);
+
+    int err = ERROR_OK;
+
+    _panel->lock();
+    _panel->set_window(0, 0, _width - 1, _height - 1);
+    while (remaining) {
+        uint32_t size = remaining < sizeof(_chunk) ? remaining : sizeof(_chunk);
+        err = _bd->read(_chunk, addr, align_up(size, _bd->get_read_size()));
+        if (err) {
+            break;
+        }
+        /* The thread sleeps during the transfer, other threads (LVGL init at
+         * boot) run. The chunk is only read again once it is sent */
+        _panel->write_pixels_async(_chunk, size / sizeof(uint16_t));
+        addr += size;
+        remaining -= size;
+    }
+    _panel->unlock();
+
+    return err;
+}
+
+int ScreenCache::read(uint32_t slot, uint16_t x, uint16_t y, uint16_t count, uint16_t *pixels)
+{
+    if (slot >= slots()) {
+        return ERROR_BAD_SLOT;
+    }
+
+    /* Read through the chunk, from and to read size boundaries */
+    bd_size_t read_size = _bd->get_read_size();
+    bd_addr_t addr = slot * _slot_size + frame_offset() + ((bd_addr_t)y * _width + x) * sizeof(uint16_t);
+    bd_addr_t start = addr - addr % read_size;
+    bd_size_t size = align_up(addr + count * sizeof(uint16_t), read_size) - start;
+    MBED_ASSERT(size <= sizeof(_chunk));
+
+    int err = _bd->read(_chunk, start, size);
+    if (err) {
+        return err;
+    }
+    memcpy(pixels, reinterpret_cast<uint8_t *>(_chunk) + (addr - start), count * sizeof(uint16_t));
+
+    return ERROR_OK;
+}
+
+int ScreenCache::invalidate(uint32_t slot)
+{
+    if (slot >= slots()) {
+        return ERROR_BAD_SLOT;
+    }
+
+    return _bd->erase(slot * _slot_size, _slot_size);
+}
+
+void ScreenCache::capture_flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
+{
+    ScreenCache *cache = capturing;
+
+    /* Rows must come in order as full width stripes to be stored as a frame */
+    if (cache->_capture_error == ERROR_OK) {
+        if (area->x1 != 0 || area->x2 != cache->_width - 1 || area->y1 != cache->_next_row) {
+            cache->_capture_error = ERROR_BAD_AREA;
+        } else {
+            cache->_capture_error = cache->append(color_p, lv_area_get_size(area) * sizeof(lv_color_t));
+            cache->_next_row = area->y2 + 1;
+        }
+    }
+
+    lv_disp_flush_ready(drv);
+}
+
+int ScreenCache::append(const void *data, uint32_t size)
+{
+    const uint8_t *src = static_cast<const uint8_t *>(data);
+    uint8_t *chunk = reinterpret_cast<uint8_t *>(_chunk);
+
+    while (size) {
+        uint32_t count = sizeof(_chunk) - _chunk_fill;
+        if (count > size) {
+            count = size;
+        }
+        memcpy(chunk + _chunk_fill, src, count);
+        _chunk_fill += count;
+        src += count;
+        size -= count;
+
+        if (_chunk_fill == sizeof(_chunk)) {
+            int err = flush_chunk();
+            if (err) {
+                return err;
+            }
+        }
+    }
+
+    return ERROR_OK;
+}
+
+int ScreenCache::flush_chunk()
+{
+    uint8_t *chunk = reinterpret_cast<uint8_t *>(_chunk);
+    bd_size_t size = align_up(_chunk_fill, _bd->get_program_size());
+
+    memset(chunk + _chunk_fill, 0xFF, size - _chunk_fill);
+    int err = _bd->program(chunk, _write_addr, size);
+    _write_addr += size;
+    _chunk_fill = 0;
+
+    return err;
+}
+
+bd_addr_t ScreenCache::frame_offset() const
+{
+    return align_up(sizeof(Header), _bd->get_program_size());
+}
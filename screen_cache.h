@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef SCREEN_CACHE_H
+#define SCREEN_CACHE_H
+
+#include "mbed.h"
+#include "lvgl.h"
+#include "panel_io.h"
+
+/* Size of the buffer between the block device and the panel, in bytes */
+#ifndef SCREEN_CACHE_CHUNK_SIZE
+#define SCREEN_CACHE_CHUNK_SIZE 1024
+#endif
+
+/**
+ * Fully rendered screens stored on a block device (SPI NOR, QSPI...).
+ *
+ * A cached screen is streamed from the block device to the panel in chunks,
+ * without LVGL: it appears in one transfer time and costs no rendering. Each
+ * slot holds a header and one full RGB565 frame, and starts on an erase
+ * boundary.
+ *
+ * show() bypasses LVGL, which is not aware of what is on the panel: it is
+ * meant for splash screens and for static screens that match the LVGL one.
+ */
+class ScreenCache {
+public:
+    enum Error {
+        ERROR_OK = 0,
+        ERROR_EMPTY_SLOT = -1,  /* nothing stored in the slot */
+        ERROR_BAD_SLOT = -2,    /* slot outside of the block device */
+        ERROR_BAD_AREA = -3,    /* the screen was not flushed as full width stripes */
+    };
+
+    ScreenCache(BlockDevice *bd, PanelIO *panel, uint16_t width, uint16_t height);
+
+    /* Initialize the block device, return 0 or a block device error */
+    int init();
+
+    /* Number of screens that fit on the block device */
+    uint32_t slots() const;
+
+    bool contains(uint32_t slot);
+
+    /* Render scr on disp and program it into slot, without updating the panel */
+    int store(lv_disp_t *disp, lv_obj_t *scr, uint32_t slot);
+
+    /* Stream the screen stored in slot to the panel. The calling thread
+     * sleeps during the SPI transfers */
+    int show(uint32_t slot);
+
+    /* Read count pixels of row y, from x, of the screen stored in slot */
+    int read(uint32_t slot, uint16_t x, uint16_t y, uint16_t count, uint16_t *pixels);
+
+    /* Erase slot */
+    int invalidate(uint32_t slot);
+
+private:
+    struct Header {
+        uint32_t magic;
+        uint16_t width;
+        uint16_t height;
+    };
+
+    static void capture_flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p);
+    int append(const void *data, uint32_t size);
+    int flush_chunk();
+    bd_addr_t frame_offset() const;
+
+    BlockDevice *_bd;
+    PanelIO *_panel;
+    uint16_t _width;
+    uint16_t _height;
+    bd_size_t _slot_size;
+
+    /* Capture state */
+    bd_addr_t _write_addr;
+    uint32_t _chunk_fill;
+    lv_coord_t _next_row;
+    int _capture_error;
+
+    /* Also the source of the SPI DMA transfers of show() */
+    MBED_ALIGN(4) uint16_t _chunk[SCREEN_CACHE_CHUNK_SIZE / sizeof(uint16_t)];
+};
+
+#endif // SCREEN_CACHE_H
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "screen_mirror.h"
+
+#define MAX_TOKEN_PIXELS 128
+
+ScreenMirror::ScreenMirror(FileHandle *link,
+        std::chrono::milliseconds frame_period,
+        std::chrono::milliseconds timeout):
+    _link(link),
+    _frame_period(frame_period),
+    _timeout(timeout),
+    _attached(false),
+    _in_frame(false),
+    _skipped(false),
+    _staged(0)
+{
+}
+
+void ScreenMirror::poll(lv_disp_t *disp)
+{
+    Kernel::Clock::time_point now = Kernel::Clock::now();
+    bool heartbeat = false;
+    uint8_t rx;
+
+    while (_link->readable() && _link->read(&rx, 1) == 1) {
+        heartbeat |= (rx == SCREEN_MIRROR_HEARTBEAT);
+    }
+
+    if (heartbeat) {
+        _heartbeat = now;
+        if (!_attached) {
+            /* New viewer: it needs a full frame */
+            _attached = true;
+            _in_frame = false;
+            _skipped = false;
+            _frame_start = now - _frame_period;
+            lv_obj_invalidate(lv_disp_get_scr_act(disp));
+        }
+    } else if (_attached && now - _heartbeat > _timeout) {
+        _attached = false;
+        return;
+    }
+
+    /* Areas dropped by the rate limit are redrawn once the next frame is due */
+    if (_skipped && !_in_frame && now - _frame_start >= _frame_period) {
+        _skipped = false;
+        _lv_inv_area(disp, &_skipped_area);
+    }
+}
+
+void ScreenMirror::send_area(lv_disp_drv_t *drv, const lv_area_t *area, const lv_color_t *pixels)
+{
+    if (!_in_frame) {
+        Kernel::Clock::time_point now = Kernel::Clock::now();
+        if (now - _frame_start < _frame_period) {
+            if (_skipped) {
+                _lv_area_join(&_skipped_area, &_skipped_area, area);
+            } else {
+                lv_area_copy(&_skipped_area, area);
+                _skipped = true;
+            }
+            return;
+        }
+        _in_frame = true;
+        _frame_start = now;
+    }
+
+    const uint8_t header[] = {
+        'L', 'V',
+        (uint8_t)area->x1, (uint8_t)(area->x1 >> 8),
+        (uint8_t)area->y1, (uint8_t)(area->y1 >> 8),
+        (uint8_t)area->x2, (uint8_t)(area->x2 >> 8),
+        (uint8_t)area->y2, (uint8_t)(area->y2 >> 8),
+    };
+    put(header, sizeof(header));
+
+    uint32_t count = lv_area_get_size(area);
+    uint32_t i = 0;
+
+    while (i < count) {
+        uint32_t n = 1;
+        while (i + n < count && n < MAX_TOKEN_PIXELS && pixels[i + n].full == pixels[i].full) {
+            n++;
+        }
+
+        if (n > 1) {
+            const uint8_t run[] = {
+                (uint8_t)(0x80 | (n - 1)),
+                (uint8_t)pixels[i].full, (uint8_t)(pixels[i].full >> 8),
+            };
+            put(run, sizeof(run));
+            i += n;
+            continue;
+        }
+
+        /* Literals stop where a run starts */
+        while (i + n < count && n < MAX_TOKEN_PIXELS
+                && !(i + n + 1 < count && pixels[i + n].full == pixels[i + n + 1].full)) {
+            n++;
+        }
+
+        const uint8_t literal = (uint8_t)(n - 1);
+        put(&literal, 1);
+        flush();
+        _link->write(&pixels[i], n * sizeof(lv_color_t));
+        i += n;
+    }
+    flush();
+
+    if (lv_disp_flush_is_last(drv)) {
+        _in_frame = false;
+    }
+}
+
+void ScreenMirror::put(const void *data, size_t len)
+{
+    if (_staged + len > sizeof(_staging)) {
+        flush();
+    }
+    memcpy(&_staging[_staged], data, len);
+    _staged += len;
+}
+
+void ScreenMirror::flush()
+{
+    if (_staged) {
+        _link->write(_staging, _staged);
+        _staged = 0;
+    }
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef SCREEN_MIRROR_H
+#define SCREEN_MIRROR_H
+
+#include "mbed.h"
+#include "lvgl.h"
+
+/* Heartbeat byte sent by the viewer while it is running */
+#define SCREEN_MIRROR_HEARTBEAT 'M'
+
+/**
+ * Mirror of the flushed areas to a host viewer (tools/mirror_viewer.py).
+ *
+ * Each flushed area is sent as a packet: "LV", x1, y1, x2, y2 (16-bit little
+ * endian) then PackBits-like tokens until the area is complete:
+ * - 0x80 | (n - 1), pixel: n copies of the pixel (n <= 128)
+ * - n - 1, n pixels: n literal pixels, sent straight from the draw buffer
+ * Pixels are RGB565, little endian.
+ *
+ * Mirroring only starts once the viewer heartbeat is received and stops when
+ * it is lost: without a viewer, a flush only costs one flag test.
+ */
+class ScreenMirror {
+public:
+    ScreenMirror(FileHandle *link,
+            std::chrono::milliseconds frame_period = 200ms,
+            std::chrono::milliseconds timeout = 2s);
+
+    /* Forward a flushed area, to be called before lv_disp_flush_ready() */
+    void tee(lv_disp_drv_t *drv, const lv_area_t *area, const lv_color_t *pixels)
+    {
+        if (_attached) {
+            send_area(drv, area, pixels);
+        }
+    }
+
+    /* Check the viewer heartbeat and schedule the redraw of the skipped areas */
+    void poll(lv_disp_t *disp);
+
+    bool attached() const
+    {
+        return _attached;
+    }
+
+private:
+    void send_area(lv_disp_drv_t *drv, const lv_area_t *area, const lv_color_t *pixels);
+    void put(const void *data, size_t len);
+    void flush();
+
+    FileHandle *_link;
+    std::chrono::milliseconds _frame_period;
+    std::chrono::milliseconds _timeout;
+    Kernel::Clock::time_point _frame_start;
+    Kernel::Clock::time_point _heartbeat;
+    bool _attached;
+    bool _in_frame;
+    bool _skipped;
+    lv_area_t _skipped_area;
+    uint8_t _staging[64];
+    size_t _staged;
+};
+
+#endif // SCREEN_MIRROR_H
@@ -0,0 +1,565 @@
+/* 118x150, 4-bit palette, made by tools/palette_convert.py */
+#define LOGO_INDEXED_WIDTH 118
+#define LOGO_INDEXED_HEIGHT 150
+#define LOGO_INDEXED_CF LV_IMG_CF_INDEXED_4BIT
+
+const uint8_t logo_indexed_data[8914] = {
+    0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xc4, 0x94, 0xff, 0x79, 0xc7, 0x8a, 0xff,
+    0xb6, 0xe0, 0xbf, 0xff, 0xf2, 0xf9, 0xf2, 0xff, 0x6d, 0xbd, 0x74, 0xff, 0xd3, 0xe8, 0xc8, 0xff,
+    0xdd, 0xf1, 0xe1, 0xff, 0x94, 0xce, 0x95, 0xff, 0xb7, 0xd2, 0x8f, 0xff, 0x82, 0xd3, 0xae, 0xff,
+    0x9e, 0xda, 0xb5, 0xff, 0x8c, 0xb2, 0x41, 0xff, 0x75, 0xbc, 0x6a, 0xff, 0x90, 0xbc, 0x5c, 0xff,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x51,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x4b, 0xb8, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x5b, 0x22, 0x22, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0xb2, 0x22,
+    0x22, 0x24, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x5b, 0x22, 0x22, 0x22, 0x22, 0x71, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x42, 0x22, 0x22, 0x22, 0x22, 0x38, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x69, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0b, 0x22, 0x22, 0x22, 0x22, 0x36, 0x66, 0x41,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x82, 0x22, 0x22, 0x22, 0x26, 0x66, 0x66, 0x38, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xc2, 0x22,
+    0x22, 0x26, 0x66, 0x66, 0x66, 0x6c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x32, 0x22, 0x26, 0x66, 0x66, 0x66, 0x66,
+    0xee, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x17, 0x22, 0x23, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee, 0x90, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x22,
+    0x66, 0x66, 0x66, 0x66, 0xee, 0xee, 0xee, 0xe8, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x09, 0x66, 0x66, 0x66, 0x66, 0x6e, 0xee,
+    0xee, 0xee, 0xea, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x55, 0x88, 0x88, 0x88, 0x51, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x53, 0x66, 0x66, 0x66, 0x6e, 0xee, 0xee, 0xee, 0xee, 0xef, 0x81, 0x11,
+    0x11, 0x11, 0x58, 0x4c, 0xbb, 0x22, 0x22, 0x22, 0xb8, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x83,
+    0x66, 0x66, 0x6e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x41, 0x11, 0x15, 0x8c, 0xb2, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x2c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x86, 0x66, 0x6e, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xef, 0xa1, 0x58, 0xcb, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2b, 0x51,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x86, 0x66, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff, 0xf4,
+    0xb2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x86, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xe6, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x8e, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xef, 0xfe, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x83, 0xee, 0xee, 0xee, 0xee, 0xee, 0xef, 0xfe, 0x62, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x81, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x53, 0xee, 0xee, 0xee, 0xee, 0xee, 0xff, 0xe2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0xee, 0xee, 0xee,
+    0xee, 0xff, 0xf6, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x2b, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0xee, 0xee, 0xee, 0xff, 0xff, 0x62, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2b, 0x01, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x18, 0xfe, 0xee, 0xef, 0xff, 0xf6, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x24, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x9f, 0xef,
+    0xff, 0xff, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x28, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x4f, 0xff, 0xff, 0xf6, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xb0, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x8f, 0xff, 0xfd, 0xe2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1a,
+    0xff, 0xdf, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x2b, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0xfd, 0xd6, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x27, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x4d, 0xf2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xb5, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x5a, 0xe2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x2b, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x32, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x24, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0xb2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xc0, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x10, 0xb2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x2c, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0xb2, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xc5, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2c, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x82, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x40, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xb8, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0xc2, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0xb4, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x04, 0xb2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xb4,
+    0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x84, 0xb2, 0x22, 0x22, 0x22, 0x22, 0x2b, 0xc8, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x58, 0x4c,
+    0xbb, 0xbc, 0x47, 0x85, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x57, 0x4c, 0xc9, 0x99, 0x9c, 0xc4, 0x78, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x58, 0x44, 0x51, 0x4e, 0xe6,
+    0x6e, 0xee, 0xee, 0xee, 0xee, 0x39, 0x48, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x15, 0x8c, 0x93, 0x63, 0x51, 0x46, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0x94, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x49,
+    0x66, 0x66, 0x63, 0x51, 0xc6, 0x66, 0x66, 0x6e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe4, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x58, 0xc3, 0x66, 0x66, 0x66, 0x69, 0x51, 0x96,
+    0x66, 0x66, 0x66, 0x66, 0xee, 0xee, 0xee, 0xee, 0x95, 0x11, 0x54, 0x51, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x08, 0x96, 0x66, 0x66, 0x66, 0x66, 0x69, 0x55, 0x96, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0xee, 0xee, 0xee, 0x81, 0x15, 0x9e, 0x37, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x88,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0xc6, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x69, 0x05, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xee, 0xe4, 0x11, 0x14,
+    0xee, 0xee, 0x45, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x81, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x43, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x69, 0x15,
+    0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x95, 0x11, 0x8e, 0xee, 0xee, 0xe9, 0x81, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0xa5, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x79, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6c, 0x18, 0x36, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x63, 0x81, 0x18, 0x3e, 0xee, 0xee, 0xee, 0x98, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0xaa, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x5c, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x6c, 0x18, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x64, 0x11, 0x59,
+    0x6e, 0xee, 0xee, 0xee, 0xe9, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x8f, 0x71, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x96, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6c,
+    0x17, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x95, 0x11, 0x46, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0x95, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1a, 0xf5, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x73, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x64, 0x14, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x63, 0x81, 0x17, 0x66, 0x66, 0xee, 0xee, 0xee, 0xee, 0xec, 0x51, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x18, 0xfa, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x76, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x64, 0x14, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x64, 0x11, 0x83,
+    0x66, 0x66, 0x6e, 0xee, 0xee, 0xee, 0xee, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xad, 0x71,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x15, 0x51, 0x14, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x64, 0x1c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x95, 0x15, 0x96, 0x66, 0x66, 0x66, 0xee, 0xee,
+    0xee, 0xee, 0x38, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7d, 0xa5, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x59,
+    0x95, 0x15, 0x96, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x64, 0x19, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x63, 0x81, 0x5c, 0x66, 0x66, 0x66, 0x66, 0x6e, 0xee, 0xee, 0xee, 0xec, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x5f, 0xd7, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x96, 0x6c, 0x51, 0x83, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x64, 0x09, 0x66, 0x66, 0x66, 0x66, 0x66, 0x64, 0x11, 0x46,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee, 0xee, 0xee, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1a,
+    0xdf, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x59, 0x66, 0x66, 0x41, 0x17, 0x66, 0x66, 0x66, 0x66, 0x66, 0x63, 0x32,
+    0x22, 0x37, 0x59, 0x22, 0x23, 0x66, 0x66, 0x66, 0x95, 0x18, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0xee, 0xee, 0xee, 0xee, 0x91, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0xdd, 0x71, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x96,
+    0x66, 0x66, 0x67, 0x10, 0x46, 0x66, 0x66, 0x66, 0x63, 0x22, 0x22, 0x22, 0x27, 0x53, 0x22, 0x22,
+    0x22, 0x36, 0x63, 0x81, 0x83, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6e, 0xee, 0xee, 0xee, 0xe8,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0xfd, 0xf5, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x5c, 0x66, 0x66, 0x66, 0x63, 0x81, 0x59,
+    0x66, 0x66, 0x63, 0x22, 0x22, 0x22, 0x22, 0x38, 0x53, 0x22, 0x22, 0x22, 0x22, 0x34, 0x15, 0x96,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee, 0xee, 0xe4, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0xad, 0xd7, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x46, 0x66, 0x66, 0x66, 0x66, 0x38, 0x18, 0x36, 0x63, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x38, 0x83, 0x22, 0x22, 0x22, 0x22, 0xc5, 0x14, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0xee, 0xee, 0xee, 0xe3, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0xad, 0xda, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x69, 0x51, 0x43, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x38, 0x82, 0x22,
+    0x22, 0x22, 0x23, 0x81, 0x73, 0x26, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6e, 0xee, 0xee,
+    0xee, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7d, 0xdd, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x83, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0xc5, 0x0c, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x28, 0x42, 0x22, 0x22, 0x22, 0x34, 0x18, 0x32,
+    0x26, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xee, 0xee, 0xe3, 0x81, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x8f, 0xdd, 0xa1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x15, 0x96, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x64, 0x05, 0x92, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x28, 0x42, 0x22, 0x22, 0x22, 0xc5, 0x5b, 0x22, 0x22, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0xe6, 0x69, 0x75, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x5f, 0xdd, 0xf5,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1c, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x23, 0x41, 0x83, 0x22, 0x22, 0x22, 0x22, 0x22, 0x35, 0xc2,
+    0x22, 0x22, 0x23, 0x50, 0xc2, 0x22, 0x22, 0x26, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x39,
+    0x75, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1a, 0xdd, 0xd7, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x86, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x22, 0x37, 0x14, 0x22, 0x22, 0x22, 0x22, 0x22, 0x35, 0xc2, 0x22, 0x22, 0x24, 0x14, 0x22,
+    0x22, 0x22, 0x23, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3c, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x1a, 0xdd, 0xda, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x15, 0x96, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x62, 0x22, 0x23, 0x85, 0xc2,
+    0x22, 0x22, 0x22, 0x22, 0x35, 0xb2, 0x22, 0x22, 0xc0, 0x83, 0x22, 0x22, 0x22, 0x22, 0x36, 0x66,
+    0x66, 0x66, 0x66, 0x94, 0x81, 0x11, 0x11, 0x58, 0x48, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1a, 0xdd,
+    0xdf, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x32, 0x22, 0x22, 0x95, 0x5b, 0x22, 0x22, 0x22, 0x22, 0xb5,
+    0xb2, 0x22, 0x23, 0x55, 0xb2, 0x22, 0x22, 0x22, 0x22, 0x26, 0x66, 0x66, 0x66, 0x97, 0x51, 0x11,
+    0x15, 0x84, 0x9e, 0xe4, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0xdd, 0xdd, 0x81, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x83, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x22, 0x22, 0x22, 0x2b, 0x58, 0x22, 0x22, 0x22, 0x22, 0xb8, 0xb2, 0x22, 0x27, 0x5c, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x23, 0x66, 0x63, 0xc8, 0x51, 0x11, 0x58, 0x49, 0xee, 0xee, 0xe4, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x17, 0xdd, 0xdd, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0xc6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x63, 0x22, 0x22, 0x22, 0x22,
+    0xc5, 0x42, 0x22, 0x22, 0x22, 0xb8, 0x22, 0x22, 0xc5, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x33, 0x48, 0x11, 0x11, 0x84, 0x93, 0x66, 0xee, 0xee, 0xec, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17,
+    0xdd, 0xdd, 0xa1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x96,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x62, 0x22, 0x22, 0x22, 0x22, 0x24, 0x5c, 0x22, 0x22, 0x22,
+    0xb8, 0x22, 0x2b, 0x58, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x39, 0x45, 0x11, 0x15, 0x7c, 0x36,
+    0x66, 0x66, 0x6e, 0xee, 0xec, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0xdd, 0xdd, 0xf5, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x87, 0x49, 0x36, 0x66, 0x66, 0x66,
+    0x66, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x45, 0xb2, 0x22, 0x22, 0xb8, 0x22, 0x28, 0x8b, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x3c, 0x75, 0x11, 0x57, 0xc3, 0x66, 0x66, 0x66, 0x66, 0x6e, 0xee, 0xec,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0xdd, 0xdd, 0xd8, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x87, 0xc3, 0x36, 0x66, 0x66, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x28, 0x82, 0x22, 0x22, 0xc4, 0x22, 0xc5, 0xb2, 0x22, 0x22, 0x22, 0x22, 0x3c, 0x81,
+    0x15, 0x7c, 0x33, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6e, 0xee, 0xec, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x17, 0xdd, 0xdd, 0xd7, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x15, 0x84, 0x93, 0x36, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2b, 0x84, 0x22,
+    0x22, 0xc4, 0x2b, 0x54, 0x22, 0x22, 0x22, 0x22, 0xb4, 0x51, 0x58, 0x49, 0x32, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x6e, 0xee, 0xe4, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0xdd, 0xdd, 0xda, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0xc4, 0x78, 0x55, 0x11, 0x11, 0x11,
+    0x15, 0x74, 0xb3, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xb8, 0xc2, 0x2b, 0x88, 0x48, 0x72, 0x22,
+    0x22, 0x22, 0xb4, 0x55, 0x84, 0xb3, 0x22, 0x22, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6e, 0xee,
+    0xe4, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0xdd, 0xdd, 0xda, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x17, 0xe6, 0x66, 0x39, 0xc4, 0x78, 0x55, 0x11, 0x11, 0x58, 0x7c, 0x92,
+    0x22, 0x22, 0x22, 0x22, 0x2c, 0x8c, 0x85, 0x11, 0x11, 0x82, 0x22, 0x22, 0xc8, 0x58, 0x4b, 0x22,
+    0x22, 0x22, 0x22, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6e, 0xee, 0xe7, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x17, 0xdd, 0xdd, 0xda, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19,
+    0x6e, 0x66, 0x66, 0x66, 0x63, 0x39, 0xc4, 0x78, 0x50, 0x11, 0x58, 0x4c, 0x32, 0x22, 0x22, 0x22,
+    0x81, 0x11, 0x11, 0x11, 0x14, 0x2b, 0x48, 0x84, 0xb2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0xee, 0xe8, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1a, 0xdd, 0xdd, 0xdf,
+    0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x53, 0xee, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x33, 0x3b, 0xc4, 0x78, 0x55, 0x58, 0x4b, 0x22, 0x2b, 0x51, 0x11, 0x11, 0x11, 0x15,
+    0x48, 0x4c, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0xee, 0x35, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1a, 0xdd, 0xdd, 0xdf, 0x51, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x7e, 0xee, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x62, 0x22, 0x22,
+    0x22, 0x3b, 0xc4, 0x88, 0x84, 0x48, 0x11, 0x11, 0x11, 0x11, 0x11, 0x4b, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xee, 0x95, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x1a, 0xdd, 0xdd, 0xdf, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0xce, 0xee, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xbb,
+    0x81, 0x11, 0x11, 0x11, 0x11, 0x15, 0xb2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xee, 0xc1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x5f, 0xdd, 0xdd,
+    0xdd, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x9e, 0xee, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x81, 0x11, 0x11, 0x11, 0x11,
+    0x18, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0xee, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x5f, 0xdd, 0xdd, 0xdd, 0x71, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x3e, 0xee, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x62, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x2b, 0x81, 0x11, 0x11, 0x11, 0x11, 0x18, 0xbb, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xe3, 0x81, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x8d, 0xdd, 0xdd, 0xdd, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x18, 0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x63, 0x22, 0x22, 0x22, 0x22, 0x22, 0xbc,
+    0x78, 0x51, 0x11, 0x11, 0x11, 0x11, 0x8b, 0x48, 0x84, 0xcb, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x69, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7d, 0xdd,
+    0xdd, 0xdd, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0xee, 0xee, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x63, 0x22, 0x22, 0x22, 0x3c, 0x48, 0x88, 0xc2, 0xc1, 0x11, 0x11, 0x11,
+    0x15, 0xb2, 0x22, 0xb4, 0x85, 0x84, 0xcb, 0x22, 0x22, 0x22, 0x22, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x6e, 0xe4, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xad, 0xdd, 0xdd, 0xdd, 0x71, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1c, 0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x62,
+    0x22, 0x39, 0xc7, 0x55, 0x8c, 0xb2, 0x22, 0x28, 0x11, 0x11, 0x11, 0x5c, 0x22, 0x22, 0x22, 0x2b,
+    0x48, 0x55, 0x87, 0xcb, 0x33, 0x22, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6e, 0xe8, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0xad, 0xdd, 0xdd, 0xdd, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x19, 0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x33, 0x94, 0x85, 0x58, 0x4b, 0x22,
+    0x22, 0x22, 0x24, 0x88, 0x55, 0x8c, 0xc4, 0x22, 0x22, 0x22, 0x22, 0x22, 0xb4, 0x85, 0x10, 0x57,
+    0x49, 0x33, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x95, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0xfd,
+    0xdd, 0xdd, 0xdd, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x59, 0xee, 0xee, 0x66,
+    0x66, 0x66, 0x66, 0x63, 0x3c, 0x75, 0x11, 0x54, 0xb2, 0x22, 0x22, 0x22, 0x22, 0xc8, 0xb2, 0xb4,
+    0x22, 0x24, 0xc2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2b, 0x48, 0x51, 0x10, 0x58, 0x4c, 0x36, 0x66,
+    0x66, 0x66, 0x66, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0xdd, 0xdd, 0xdd, 0xdf, 0x81, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x59, 0xee, 0xee, 0xe6, 0x66, 0x66, 0x39, 0x48, 0x51,
+    0x15, 0x7c, 0x32, 0x22, 0x22, 0x22, 0x22, 0x2b, 0x5c, 0x22, 0xb4, 0x22, 0x2b, 0x8b, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x23, 0xb4, 0x85, 0x11, 0x11, 0x58, 0x4c, 0x96, 0x66, 0x63, 0x51, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x1a, 0xdd, 0xdd, 0xdd, 0xdf, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x53, 0xee, 0xee, 0x66, 0x69, 0xc7, 0x81, 0x11, 0x58, 0xc3, 0x32, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0xb8, 0x42, 0x22, 0xc4, 0x22, 0x22, 0x48, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x39, 0x48, 0x51, 0x11, 0x11, 0x58, 0x7c, 0x94, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x5f,
+    0xdd, 0xdd, 0xdd, 0xdf, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x53, 0xee, 0xe3,
+    0x94, 0x85, 0x11, 0x15, 0x84, 0x93, 0x66, 0x63, 0x22, 0x22, 0x22, 0x22, 0x23, 0x88, 0x22, 0x22,
+    0x4c, 0x22, 0x22, 0xb5, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x26, 0x63, 0x94, 0x85,
+    0x11, 0x11, 0x11, 0x55, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7d, 0xdd, 0xdd, 0xdd, 0xdf, 0x51,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x59, 0x3c, 0x78, 0x01, 0x11, 0x18, 0x49, 0x36,
+    0x66, 0x66, 0x66, 0x22, 0x22, 0x22, 0x22, 0x27, 0x5b, 0x22, 0x22, 0x7c, 0x22, 0x22, 0x2c, 0x5b,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x23, 0x66, 0x66, 0x66, 0x39, 0x48, 0x51, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0xad, 0xdd, 0xdd, 0xdd, 0xda, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x18, 0x51, 0x11, 0x11, 0x57, 0x93, 0x66, 0x66, 0x66, 0x66, 0x66, 0x62, 0x22,
+    0x22, 0x23, 0x45, 0xc2, 0x22, 0x22, 0x8b, 0x22, 0x22, 0x22, 0x88, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x26, 0x66, 0x66, 0x66, 0x66, 0x63, 0x94, 0x85, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15,
+    0xfd, 0xdd, 0xdd, 0xdd, 0xda, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x15, 0x7c, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x63, 0x22, 0x22, 0x24, 0x04, 0x22, 0x22,
+    0x23, 0x8b, 0x22, 0x22, 0x22, 0xc5, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x38, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0xdd, 0xdd, 0xdd, 0xdd, 0xd7,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x58, 0x43, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x32, 0x22, 0xc5, 0x73, 0x22, 0x22, 0x2b, 0x53, 0x22, 0x22, 0x22,
+    0x27, 0x5c, 0x22, 0x22, 0x22, 0x22, 0x23, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x95, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x1a, 0xdd, 0xdd, 0xdd, 0xdd, 0xd7, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x17, 0x9e, 0xee, 0xee, 0xe6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x62, 0x29, 0x58, 0x32, 0x22, 0x22, 0x2c, 0x53, 0x22, 0x22, 0x22, 0x2b, 0x58, 0x32, 0x22, 0x22,
+    0x22, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x63, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x8d, 0xdd, 0xdd, 0xdd, 0xdd, 0xf5, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14,
+    0xee, 0xee, 0xee, 0xee, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x95, 0x59, 0x22, 0x22,
+    0x22, 0x24, 0x82, 0x22, 0x22, 0x22, 0x22, 0x41, 0x43, 0x22, 0x22, 0x23, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x6c, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xad, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xa1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0xee, 0xee, 0xee, 0xee, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x63, 0x81, 0x42, 0x22, 0x22, 0x22, 0x27, 0x83, 0x22, 0x22,
+    0x22, 0x22, 0x35, 0x5c, 0x22, 0x22, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x95, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xa1, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x3e, 0xee, 0xee, 0xee, 0xe6, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x37, 0x17, 0x32, 0x22, 0x22, 0x22, 0x38, 0x83, 0x22, 0x22, 0x22, 0x22, 0x24, 0x15, 0x32,
+    0x26, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x63, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x1a, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x9e, 0xee, 0xee, 0xee, 0xe6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x63, 0x71, 0x83, 0x66, 0x22,
+    0x22, 0x22, 0x35, 0x72, 0x22, 0x22, 0x22, 0x22, 0x23, 0x81, 0x73, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x64, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x8f, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdf, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x4e, 0xee, 0xee, 0xee,
+    0xee, 0x66, 0x66, 0x66, 0x66, 0x66, 0x64, 0x15, 0x96, 0x66, 0x63, 0x22, 0x22, 0x95, 0x42, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0xc0, 0x1c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xc0, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xad, 0xdd, 0xdd, 0xdd, 0xdd, 0xda, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x8e, 0xee, 0xee, 0xee, 0xee, 0xe6, 0x66, 0x66, 0x66,
+    0x66, 0xc5, 0x04, 0x66, 0x66, 0x66, 0x66, 0x32, 0xc1, 0x42, 0x22, 0x22, 0x22, 0x22, 0x22, 0x37,
+    0x15, 0x96, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x69, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x17, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd7, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x19, 0xee, 0xee, 0xee, 0xee, 0xee, 0x66, 0x66, 0x66, 0x6c, 0x51, 0x76, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x41, 0xc2, 0x22, 0x22, 0x33, 0x36, 0x66, 0x69, 0x51, 0x83, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x95, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x5a, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xf5, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0x66, 0x66, 0x66, 0x95, 0x18, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x41, 0xc6,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x71, 0x14, 0x66, 0x66, 0x66, 0x66, 0x66, 0x69, 0x81, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xad, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xa1, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x9e, 0xee, 0xee, 0xee, 0xee, 0xe6, 0x66,
+    0x63, 0x81, 0x59, 0x66, 0x66, 0x66, 0x66, 0x66, 0x63, 0x81, 0x96, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x35, 0x15, 0x96, 0x66, 0x66, 0x66, 0x66, 0x98, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x18, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x7e, 0xee, 0xee, 0xee, 0xee, 0xee, 0x66, 0x38, 0x10, 0xc6, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x63, 0x85, 0x96, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x64, 0x11, 0x83, 0x66,
+    0x66, 0x66, 0x69, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x5a, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdf, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0a,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xe3, 0x71, 0x17, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x63, 0x55,
+    0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x63, 0x81, 0x14, 0x66, 0x66, 0x66, 0x98, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xad, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xda, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x3e, 0xee, 0xee, 0xee, 0xee,
+    0x64, 0x11, 0x83, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x69, 0x15, 0x36, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0xc1, 0x15, 0x96, 0x66, 0x69, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x17, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xf5, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7e, 0xee, 0xee, 0xee, 0xee, 0xc0, 0x15, 0x96, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x6c, 0x18, 0x36, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x68, 0x11,
+    0x83, 0x66, 0x45, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x8f, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xa1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x14, 0xee, 0xee, 0xee, 0xe9, 0x51, 0x5c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x64,
+    0x18, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x69, 0x51, 0x17, 0x37, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0xad, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0x81, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x9e, 0xee, 0xee,
+    0x95, 0x11, 0x46, 0xee, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x18, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x71, 0x10, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x1a, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xda, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x59, 0xee, 0xe3, 0x81, 0x18, 0x3e, 0xee, 0xee,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x38, 0x17, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x95, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xad, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xf5, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x15, 0xae, 0x38, 0x11, 0x53, 0xee, 0xee, 0xee, 0xee, 0x66, 0x66, 0x66, 0x66,
+    0x35, 0x17, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x95, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0x71, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x54,
+    0x71, 0x15, 0x9e, 0xee, 0xee, 0xee, 0xee, 0xee, 0x66, 0x66, 0x66, 0x95, 0x14, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x34, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x7d, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xda, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0xee, 0xee, 0xee,
+    0xee, 0xee, 0xee, 0xee, 0xe6, 0x66, 0xc1, 0x1c, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x34,
+    0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xf8, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x83, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
+    0xe6, 0x41, 0x1c, 0x66, 0x66, 0x66, 0x66, 0x6e, 0x6e, 0x34, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xa1, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x57, 0x9e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xe6, 0x71, 0x19, 0x6e, 0xee,
+    0xee, 0xe6, 0x66, 0x94, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xda, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x57, 0x9e,
+    0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0x81, 0x59, 0x6e, 0xee, 0x6e, 0x63, 0xc8, 0x51, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0xad, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xf8, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15,
+    0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x49, 0x3e, 0xee, 0xee, 0xee,
+    0xee, 0xe3, 0x51, 0x53, 0x6e, 0x63, 0x94, 0x85, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x5a, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0x71, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x77, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 0x87, 0x49, 0x93, 0xee, 0xee, 0xe9, 0x51, 0x5c, 0xc4,
+    0x88, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0xad,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xda, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x55, 0x88, 0x88, 0x88, 0x11, 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7f, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xa5, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x15, 0xa7, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x5a, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xda, 0x51, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x5a, 0xa5, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0xfd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xf5, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0xaa, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0xaf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdf, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x5a, 0xf7, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x15, 0x7f, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xf8, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15,
+    0xad, 0xa8, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7a, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xda, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x5a, 0xdf, 0xa5, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7a, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xa5, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x7d, 0xdf, 0x75, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15,
+    0x7a, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xda, 0x51, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x17, 0xfd, 0xdf, 0x75, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x7f, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x8a, 0xdd,
+    0xdf, 0xa7, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x57, 0xaf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xf8, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x7f, 0xdd, 0xdd, 0xfa, 0x75, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x58, 0x7a, 0xfd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xda, 0x51, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0xad, 0xdd, 0xdd, 0xdf, 0xa7, 0x75, 0x51, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x15, 0x58, 0x7a, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x57, 0xfd, 0xdd, 0xdd, 0xdd, 0xdf, 0xfa, 0xaa, 0x77, 0x77, 0x77, 0x77, 0x77, 0x7a, 0xaf,
+    0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xa5,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x5a, 0xfd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xa8, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x8a, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xa7, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x8a, 0xfd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xa8, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x57, 0xad, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdf, 0xa8, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x58, 0xaf, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xfa, 0x75, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x8a, 0xaf, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xfa, 0xa7, 0x51, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x15, 0x77, 0xaa, 0xff, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0xdf, 0xfa, 0xa7, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x15, 0x58, 0x77, 0x7a, 0xaa, 0xaa, 0xaa, 0xa7, 0x77, 0x85, 0x51, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11,
+};
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "sprite_layer.h"
+
+typedef void (*flush_cb_t)(lv_disp_drv_t *, const lv_area_t *, lv_color_t *);
+
+/* Layer being captured by capture_flush() */
+static SpriteLayer *capturing;
+
+static lv_area_t make_area(int32_t x1, int32_t y1, int32_t x2, int32_t y2)
+{
+    lv_area_t area;
+    lv_area_set(&area, x1, y1, x2, y2);
+
+    return area;
+}
+
+SpriteLayer::SpriteLayer(PanelIO *panel, uint16_t width, uint16_t height):
+    _panel(panel),
+    _width(width),
+    _height(height),
+    _frame(nullptr),
+    _cache(nullptr),
+    _slot(0),
+    _sprites(),
+    _capture(nullptr),
+    _capture_error(ERROR_OK)
+{
+    MBED_ASSERT(width <= SPRITE_LAYER_MAX_SPAN);
+}
+
+int SpriteLayer::capture(lv_disp_t *disp, lv_obj_t *scr, uint16_t *frame)
+{
+    _capture = frame;
+    _capture_error = ERROR_OK;
+
+    /* Render the whole screen into the frame instead of the panel */
+    lv_obj_t *previous = lv_disp_get_scr_act(disp);
+    flush_cb_t target_flush = disp->driver->flush_cb;
+    capturing = this;
+    disp->driver->flush_cb = capture_flush;
+
+    lv_disp_load_scr(scr);
+    lv_obj_invalidate(scr);
+    lv_refr_now(disp);
+
+    disp->driver->flush_cb = target_flush;
+    capturing = nullptr;
+    lv_disp_load_scr(previous);
+    lv_obj_invalidate(previous);
+    _capture = nullptr;
+
+    if (_capture_error != ERROR_OK) {
+        return _capture_error;
+    }
+    set_background(frame);
+
+    return ERROR_OK;
+}
+
+void SpriteLayer::set_background(const uint16_t *frame)
+{
+    _frame = frame;
+    _cache = nullptr;
+}
+
+int SpriteLayer::set_background(ScreenCache *cache, uint32_t slot)
+{
+    if (!cache->contains(slot)) {
+        return ScreenCache::ERROR_EMPTY_SLOT;
+    }
+
+    _frame = nullptr;
+    _cache = cache;
+    _slot = slot;
+
+    return ERROR_OK;
+}
+
+int SpriteLayer::add(const lv_img_dsc_t *img, lv_coord_t x, lv_coord_t y)
+{
+    if (img->header.cf != LV_IMG_CF_TRUE_COLOR && img->header.cf != LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED) {
+        return ERROR_FORMAT;
+    }
+
+    for (int id = 0; id < SPRITE_LAYER_MAX_SPRITES; id++) {
+        Sprite &sprite = _sprites[id];
+        if (sprite.img) {
+            continue;
+        }
+
+        sprite.img = img;
+        sprite.area = make_area(x, y, x + img->header.w - 1, y + img->header.h - 1);
+        _panel->lock();
+        compose(sprite.area);
+        _panel->unlock();
+
+        return id;
+    }
+
+    return ERROR_FULL;
+}
+
+uint32_t SpriteLayer::move(int id, lv_coord_t x, lv_coord_t y)
+{
+    if (id < 0 || id >= SPRITE_LAYER_MAX_SPRITES || !_sprites[id].img) {
+        return 0;
+    }
+
+    Sprite &sprite = _sprites[id];
+    lv_area_t old = sprite.area;
+    sprite.area = make_area(x, y, x + sprite.img->header.w - 1, y + sprite.img->header.h - 1);
+
+    uint32_t sent = 0;
+    lv_area_t overlap;
+
+    _panel->lock();
+    if (!_lv_area_intersect(&overlap, &old, &sprite.area)) {
+        sent += compose(old);
+    } else {
+        /* Only the part of the old rectangle left uncovered: the bands above
+         * and below the new one, then the sides. Empty ones are skipped */
+        sent += compose(make_area(old.x1, old.y1, old.x2, overlap.y1 - 1));
+        sent += compose(make_area(old.x1, overlap.y2 + 1, old.x2, old.y2));
+        sent += compose(make_area(old.x1, overlap.y1, overlap.x1 - 1, overlap.y2));
+        sent += compose(make_area(overlap.x2 + 1, overlap.y1, old.x2, overlap.y2));
+    }
+    sent += compose(sprite.area);
+    _panel->unlock();
+
+    return sent;
+}
+
+void SpriteLayer::remove(int id)
+{
+    if (id < 0 || id >= SPRITE_LAYER_MAX_SPRITES || !_sprites[id].img) {
+        return;
+    }
+
+    _sprites[id].img = nullptr;
+    _panel->lock();
+    compose(_sprites[id].area);
+    _panel->unlock();
+}
+
+void SpriteLayer::redraw(const lv_area_t &area)
+{
+    _panel->lock();
+    compose(area);
+    _panel->unlock();
+}
+
+void SpriteLayer::capture_flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p)
+{
+    SpriteLayer *layer = capturing;
+
+    if (area->x1 < 0 || area->y1 < 0 || area->x2 >= layer->_width || area->y2 >= layer->_height) {
+        layer->_capture_error = ERROR_BAD_AREA;
+    } else {
+        lv_coord_t w = lv_area_get_width(area);
+        for (lv_coord_t y = area->y1; y <= area->y2; y++) {
+            memcpy(&layer->_capture[y * layer->_width + area->x1], color_p, w * sizeof(uint16_t));
+            color_p += w;
+        }
+    }
+
+    lv_disp_flush_ready(drv);
+}
+
+/* Send area in one window, row by row: the background, then the sprites
+ * over it. The bus is locked by the caller */
+uint32_t SpriteLayer::compose(lv_area_t area)
+{
+    const lv_area_t screen = {0, 0, (lv_coord_t)(_width - 1), (lv_coord_t)(_height - 1)};
+
+    if (!_lv_area_intersect(&area, &area, &screen)) {
+        return 0;
+    }
+
+    lv_coord_t w = lv_area_get_width(&area);
+    lv_color_t key = LV_COLOR_CHROMA_KEY;
+
+    _panel->set_window(area.x1, area.y1, area.x2, area.y2);
+    for (lv_coord_t y = area.y1; y <= area.y2; y++) {
+        read_background(area.x1, y, w);
+
+        for (const Sprite &sprite : _sprites) {
+            if (!sprite.img || y < sprite.area.y1 || y > sprite.area.y2) {
+                continue;
+            }
+            lv_coord_t x1 = LV_MAX(area.x1, sprite.area.x1);
+            lv_coord_t x2 = LV_MIN(area.x2, sprite.area.x2);
+            if (x1 > x2) {
+                continue;
+            }
+
+            const lv_color_t *src = (const lv_color_t *)sprite.img->data
+                    + (y - sprite.area.y1) * sprite.img->header.w + (x1 - sprite.area.x1);
+            uint16_t *dst = &_line[x1 - area.x1];
+            if (sprite.img->header.cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED) {
+                for (lv_coord_t i = 0; i <= x2 - x1; i++) {
+                    if (src[i].full != key.full) {
+                        dst[i] = src[i].full;
+                    }
+                }
+            } else {
+                memcpy(dst, src, (x2 - x1 + 1) * sizeof(uint16_t));
+            }
+        }
+
+        _panel->write_pixels(_line, w);
+    }
+
+    return lv_area_get_size(&area);
+}
+
+void SpriteLayer::read_background(lv_coord_t x, lv_coord_t y, lv_coord_t count)
+{
+    if (_frame) {
+        memcpy(_line, &_frame[y * _width + x], count * sizeof(uint16_t));
+    } else if (!_cache || _cache->read(_slot, x, y, count, _line) != ScreenCache::ERROR_OK) {
+        memset(_line, 0, count * sizeof(uint16_t));
+    }
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef SPRITE_LAYER_H
+#define SPRITE_LAYER_H
+
+#include "mbed.h"
+#include "lvgl.h"
+#include "panel_io.h"
+#include "screen_cache.h"
+
+/* Sprites shown at the same time */
+#ifndef SPRITE_LAYER_MAX_SPRITES
+#define SPRITE_LAYER_MAX_SPRITES 4
+#endif
+
+/* Widest panel row, in pixels */
+#ifndef SPRITE_LAYER_MAX_SPAN
+#define SPRITE_LAYER_MAX_SPAN 160
+#endif
+
+/**
+ * Small images moved over a static background, drawn straight to the panel.
+ *
+ * The background is a full frame kept in RAM (capture()) or in a slot of a
+ * ScreenCache. Moving a sprite only sends the part of its old rectangle it
+ * no longer covers, restored from the background, and its new rectangle,
+ * each in its own tight window: the cost of a move depends on the sprite
+ * size, not on the widgets under it. Overlapping sprites are composed in the
+ * order they were added.
+ *
+ * Like ScreenCache::show(), the layer bypasses LVGL: the background must be
+ * what LVGL shows, and LVGL must not refresh the screen while the sprites
+ * are shown (or redraw() them after it did).
+ */
+class SpriteLayer {
+public:
+    enum Error {
+        ERROR_OK = 0,
+        ERROR_FULL = -1,     /* SPRITE_LAYER_MAX_SPRITES already added */
+        ERROR_FORMAT = -2,   /* not a true color or chroma keyed true color image */
+        ERROR_BAD_AREA = -3, /* an area was flushed outside of the frame */
+    };
+
+    SpriteLayer(PanelIO *panel, uint16_t width, uint16_t height);
+
+    /* Render scr on disp into frame (width x height RGB565 pixels), without
+     * updating the panel, and use it as the background */
+    int capture(lv_disp_t *disp, lv_obj_t *scr, uint16_t *frame);
+
+    /* Use a frame already in RAM as the background */
+    void set_background(const uint16_t *frame);
+
+    /* Use the screen stored in a slot of cache as the background. Return a
+     * ScreenCache error if the slot is empty */
+    int set_background(ScreenCache *cache, uint32_t slot);
+
+    /* Show img at x, y. LV_COLOR_CHROMA_KEY pixels of a chroma keyed image
+     * are transparent. Return the sprite id, or an error */
+    int add(const lv_img_dsc_t *img, lv_coord_t x, lv_coord_t y);
+
+    /* Move a sprite, return the number of pixels sent */
+    uint32_t move(int id, lv_coord_t x, lv_coord_t y);
+
+    /* Restore the background under a sprite and forget it */
+    void remove(int id);
+
+    /* Send area again, background and sprites, once LVGL has drawn over it */
+    void redraw(const lv_area_t &area);
+
+private:
+    struct Sprite {
+        const lv_img_dsc_t *img;
+        lv_area_t area;
+    };
+
+    static void capture_flush(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *color_p);
+    uint32_t compose(lv_area_t area);
+    void read_background(lv_coord_t x, lv_coord_t y, lv_coord_t count);
+
+    PanelIO *_panel;
+    uint16_t _width;
+    uint16_t _height;
+    const uint16_t *_frame;
+    ScreenCache *_cache;
+    uint32_t _slot;
+    Sprite _sprites[SPRITE_LAYER_MAX_SPRITES];
+
+    /* Capture state */
+    uint16_t *_capture;
+    int _capture_error;
+
+    uint16_t _line[SPRITE_LAYER_MAX_SPAN];
+};
+
+#endif // SPRITE_LAYER_H
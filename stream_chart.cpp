@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "stream_chart.h"
+
+MBED_STATIC_ASSERT((STREAM_CHART_QUEUE_SIZE & (STREAM_CHART_QUEUE_SIZE - 1)) == 0,
+        "STREAM_CHART_QUEUE_SIZE must be a power of two");
+
+StreamChart::StreamChart(PanelIO *panel, const lv_area_t &area, Mode mode):
+    _panel(panel),
+    _area(area),
+    _mode(mode),
+    _min(0),
+    _max(100),
+    _background(LV_COLOR_MAKE(0, 0, 0)),
+    _trace(LV_COLOR_MAKE(0, 255, 0)),
+    _cursor(LV_COLOR_MAKE(64, 64, 64)),
+    _head(0),
+    _last(-1),
+    _queue_head(0),
+    _queue_tail(0)
+{
+    MBED_ASSERT(lv_area_get_width(&_area) <= STREAM_CHART_MAX_SPAN);
+    MBED_ASSERT(lv_area_get_height(&_area) <= STREAM_CHART_MAX_SPAN);
+}
+
+void StreamChart::set_range(int32_t min, int32_t max)
+{
+    _min = min;
+    _max = max > min ? max : min + 1;
+}
+
+void StreamChart::set_colors(lv_color_t background, lv_color_t trace, lv_color_t cursor)
+{
+    _background = background;
+    _trace = trace;
+    _cursor = cursor;
+}
+
+void StreamChart::clear()
+{
+    lv_coord_t w = lv_area_get_width(&_area);
+    lv_coord_t h = lv_area_get_height(&_area);
+
+    for (lv_coord_t x = 0; x < w; x++) {
+        _line[x] = _background.full;
+    }
+
+    _panel->lock();
+
+    /* Same window for the whole area, written one row at a time */
+    _panel->set_window(_area.x1, _area.y1, _area.x2, _area.y2);
+    for (lv_coord_t y = 0; y < h; y++) {
+        _panel->write_pixels(_line, w);
+    }
+
+    _head = 0;
+    _last = -1;
+
+    if (_mode == Mode::Scroll) {
+        _panel->set_scroll_area(_area.y1, h);
+        _panel->scroll_to(_area.y1);
+    } else {
+        draw_cursor();
+    }
+
+    _panel->unlock();
+}
+
+bool StreamChart::push(int32_t sample)
+{
+    uint32_t head = core_util_atomic_load_u32(&_queue_head);
+
+    if (head - core_util_atomic_load_u32(&_queue_tail) >= STREAM_CHART_QUEUE_SIZE) {
+        return false;
+    }
+
+    _queue[head & (STREAM_CHART_QUEUE_SIZE - 1)] = sample;
+    core_util_atomic_store_u32(&_queue_head, head + 1);
+
+    return true;
+}
+
+uint32_t StreamChart::flush()
+{
+    uint32_t count = 0;
+    uint32_t tail = core_util_atomic_load_u32(&_queue_tail);
+
+    _panel->lock();
+    while (tail != core_util_atomic_load_u32(&_queue_head)) {
+        int32_t sample = _queue[tail & (STREAM_CHART_QUEUE_SIZE - 1)];
+
+        if (_mode == Mode::Scroll) {
+            draw_row(map(sample, lv_area_get_width(&_area)));
+        } else {
+            lv_coord_t h = lv_area_get_height(&_area);
+            draw_column(h - 1 - map(sample, h));
+        }
+
+        tail++;
+        core_util_atomic_store_u32(&_queue_tail, tail);
+        count++;
+    }
+
+    /* Move the oldest row to the top of the scrolling area once per batch */
+    if (_mode == Mode::Scroll && count) {
+        _panel->scroll_to(_area.y1 + _head);
+    }
+    _panel->unlock();
+
+    return count;
+}
+
+lv_coord_t StreamChart::map(int32_t sample, lv_coord_t span) const
+{
+    int32_t value = LV_CLAMP(_min, sample, _max);
+
+    return (lv_coord_t)(((value - _min) * (span - 1)) / (_max - _min));
+}
+
+void StreamChart::draw_column(lv_coord_t y)
+{
+    lv_coord_t w = lv_area_get_width(&_area);
+    lv_coord_t h = lv_area_get_height(&_area);
+    lv_coord_t from = _last < 0 ? y : _last;
+    lv_coord_t y_min = LV_MIN(from, y);
+    lv_coord_t y_max = LV_MAX(from, y);
+
+    /* The sample column and the cursor next to it share one window */
+    lv_coord_t stride = (_head + 1 < w) ? 2 : 1;
+
+    for (lv_coord_t row = 0; row < h; row++) {
+        bool on_trace = row >= y_min && row <= y_max;
+        _line[row * stride] = on_trace ? _trace.full : _background.full;
+        if (stride == 2) {
+            _line[row * stride + 1] = _cursor.full;
+        }
+    }
+
+    lv_coord_t x = _area.x1 + _head;
+    _panel->set_window(x, _area.y1, x + stride - 1, _area.y2);
+    _panel->write_pixels(_line, h * stride);
+
+    _last = y;
+    _head++;
+    if (_head == w) {
+        _head = 0;
+        draw_cursor();
+    }
+}
+
+void StreamChart::draw_cursor()
+{
+    lv_coord_t h = lv_area_get_height(&_area);
+
+    for (lv_coord_t row = 0; row < h; row++) {
+        _line[row] = _cursor.full;
+    }
+
+    lv_coord_t x = _area.x1 + _head;
+    _panel->set_window(x, _area.y1, x, _area.y2);
+    _panel->write_pixels(_line, h);
+}
+
+void StreamChart::draw_row(lv_coord_t x)
+{
+    lv_coord_t w = lv_area_get_width(&_area);
+    lv_coord_t h = lv_area_get_height(&_area);
+    lv_coord_t from = _last < 0 ? x : _last;
+    lv_coord_t x_min = LV_MIN(from, x);
+    lv_coord_t x_max = LV_MAX(from, x);
+
+    for (lv_coord_t col = 0; col < w; col++) {
+        bool on_trace = col >= x_min && col <= x_max;
+        _line[col] = on_trace ? _trace.full : _background.full;
+    }
+
+    /* The head row holds the oldest sample, it is replaced by the newest */
+    lv_coord_t y = _area.y1 + _head;
+    _panel->set_window(_area.x1, y, _area.x2, y);
+    _panel->write_pixels(_line, w);
+
+    _last = x;
+    _head = (_head + 1) % h;
+}
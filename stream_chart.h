@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef STREAM_CHART_H
+#define STREAM_CHART_H
+
+#include "mbed.h"
+#include "lvgl.h"
+#include "panel_io.h"
+
+/* Samples waiting to be drawn, power of two */
+#ifndef STREAM_CHART_QUEUE_SIZE
+#define STREAM_CHART_QUEUE_SIZE 64
+#endif
+
+/* Longest column (sweep mode) or row (scroll mode) of a chart, in pixels */
+#ifndef STREAM_CHART_MAX_SPAN
+#define STREAM_CHART_MAX_SPAN 160
+#endif
+
+/**
+ * Telemetry chart drawn straight to the panel, one sample at a time.
+ *
+ * Samples are laid out as a ring over the chart area: a new sample only draws
+ * its own column (or row) and the rest of the trace is never sent again, so
+ * the SPI cost of a sample does not depend on the chart size. In scroll mode
+ * the ring is the vertical scrolling area of the panel and the controller
+ * shifts the trace by itself.
+ *
+ * The chart area belongs to the chart: LVGL must not draw over it.
+ */
+class StreamChart {
+public:
+    enum class Mode {
+        Sweep,  /* time along x, a cursor sweeps from left to right */
+        Scroll, /* time along y, the area must span the whole panel width */
+    };
+
+    StreamChart(PanelIO *panel, const lv_area_t &area, Mode mode = Mode::Sweep);
+
+    void set_range(int32_t min, int32_t max);
+
+    void set_colors(lv_color_t background, lv_color_t trace, lv_color_t cursor);
+
+    /* Paint the whole chart area and restart the trace */
+    void clear();
+
+    /* Queue a sample, ISR safe for a single producer. Returns false if the queue is full */
+    bool push(int32_t sample);
+
+    /* Draw the queued samples and return how many were drawn */
+    uint32_t flush();
+
+private:
+    lv_coord_t map(int32_t sample, lv_coord_t span) const;
+    void draw_column(lv_coord_t y);
+    void draw_cursor();
+    void draw_row(lv_coord_t x);
+
+    PanelIO *_panel;
+    lv_area_t _area;
+    Mode _mode;
+    int32_t _min;
+    int32_t _max;
+    lv_color_t _background;
+    lv_color_t _trace;
+    lv_color_t _cursor;
+    lv_coord_t _head;
+    lv_coord_t _last;
+
+    int32_t _queue[STREAM_CHART_QUEUE_SIZE];
+    volatile uint32_t _queue_head;
+    volatile uint32_t _queue_tail;
+
+    uint16_t _line[2 * STREAM_CHART_MAX_SPAN];
+};
+
+#endif // STREAM_CHART_H
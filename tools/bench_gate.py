@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+# Copyright (c) 2021, CATIE
+# SPDX-License-Identifier: Apache-2.0
+"""Regression gate for the on-target benchmark (bench.h).
+
+Reads the "BENCH {...}" line printed by a benchmark build, from a log file or
+a serial port, and compares it with a baseline:
+- the screen CRC (snapshot) must be identical,
+- render time, flush count and SPI bytes must not get more than N% worse,
+- and neither must the layout, line, label and sprite times.
+
+Usage:
+    bench_gate.py --log console.log --baseline bench_baseline.json [--threshold 10]
+    bench_gate.py --port /dev/ttyUSB0 --baseline bench_baseline.json --update
+"""
+
+import argparse
+import json
+import sys
+
+METRICS = ("render_us", "flushes", "spi_bytes")
+LAYOUT_METRICS = ("uncached_ns", "cached_ns")
+LINE_METRICS = ("fast_ns", "diagonal_ns", "batch_ns", "batch_diagonal_ns")
+LABEL_METRICS = ("plain_us", "cached_us")
+SPRITE_METRICS = ("lvgl_us", "sprite_us")
+PREFIX = "BENCH "
+
+
+def read_result(args):
+    if args.log:
+        with open(args.log, errors="replace") as log:
+            lines = log.readlines()
+    else:
+        import serial
+
+        port = serial.Serial(args.port, args.baudrate, timeout=args.timeout)
+        lines = iter(lambda: port.readline().decode(errors="replace"), "")
+    for line in lines:
+        if line.startswith(PREFIX):
+            return json.loads(line[len(PREFIX):])
+    sys.exit("no benchmark result found")
+
+
+def check(name, metric, base, value, threshold, failures):
+    change = 100.0 * (value - base) / base if base else 0.0
+    print("%-10s %-11s %10d %10d %+7.1f%%" % (name, metric, base, value, change))
+    if change > threshold:
+        failures.append("%s: %s is %.1f%% worse (%d -> %d)"
+                        % (name, metric, change, base, value))
+
+
+def compare(result, baseline, threshold):
+    failures = []
+    reference = {screen["name"]: screen for screen in baseline["screens"]}
+    for screen in result["screens"]:
+        name = screen["name"]
+        if name not in reference:
+            print("%-10s new screen, not in the baseline" % name)
+            continue
+        expected = reference[name]
+        if screen["crc"] != expected["crc"]:
+            failures.append("%s: snapshot changed (crc %s, expected %s)"
+                            % (name, screen["crc"], expected["crc"]))
+        for metric in METRICS:
+            check(name, metric, expected[metric], screen[metric], threshold, failures)
+    if "layout" in result and "layout" in baseline:
+        for metric in LAYOUT_METRICS:
+            check("layout", metric, baseline["layout"][metric], result["layout"][metric],
+                  threshold, failures)
+    if "lines" in result and "lines" in baseline:
+        for metric in LINE_METRICS:
+            if metric not in baseline["lines"]:
+                continue
+            check("lines", metric, baseline["lines"][metric], result["lines"][metric],
+                  threshold, failures)
+    if "labels" in result and "labels" in baseline:
+        for metric in LABEL_METRICS:
+            check("labels", metric, baseline["labels"][metric], result["labels"][metric],
+                  threshold, failures)
+    if "sprites" in result and "sprites" in baseline:
+        for metric in SPRITE_METRICS:
+            check("sprites", metric, baseline["sprites"][metric], result["sprites"][metric],
+                  threshold, failures)
+    return failures
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--log", help="console log of a benchmark build")
+    source.add_argument("--port", help="serial port of the target console")
+    parser.add_argument("--baudrate", type=int, default=9600)
+    parser.add_argument("--timeout", type=float, default=30)
+    parser.add_argument("--baseline", required=True, help="baseline JSON file")
+    parser.add_argument("--threshold", type=float, default=10,
+                        help="allowed degradation in percent (default: 10)")
+    parser.add_argument("--update", action="store_true",
+                        help="record the result as the new baseline")
+    args = parser.parse_args()
+
+    result = read_result(args)
+    if args.update:
+        with open(args.baseline, "w") as baseline:
+            json.dump(result, baseline, indent=4)
+            baseline.write("\n")
+        print("baseline written to %s" % args.baseline)
+        return
+
+    with open(args.baseline) as baseline:
+        failures = compare(result, json.load(baseline), args.threshold)
+    for failure in failures:
+        print("FAIL " + failure)
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+# Copyright (c) 2021, CATIE
+# SPDX-License-Identifier: Apache-2.0
+"""Rebuild the text of the binary log (binary_log.h) from the firmware ELF.
+
+The target sends, for each message, the address of its format string and its
+raw 32-bit arguments. The format strings, and the strings passed as %s, are
+read from the ELF of the same build (requires pyelftools).
+
+The input is the stimulus port 0 stream captured from the SWO, either raw or,
+with --itm, still in ITM packets (as written by OpenOCD "itm port 0 on" with
+"tpiu config ... file"). Console text on the same port is skipped.
+
+Usage:
+    binlog_decode.py --elf BUILD/ZEST_CORE_STM32L4A6RG/GCC_ARM/zest-display-lcd-demo.elf swo.bin
+    binlog_decode.py --elf zest-display-lcd-demo.elf --itm swo.itm
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+SYNC = 0xA5
+MAX_ARGS = 6
+LEVELS = {0: "Trace", 1: "Info", 2: "Warn", 3: "Error", 4: "User"}
+CONVERSION = re.compile(r"%[-+ #0]*\d*(?:\.\d+)?(?:hh|h|ll|l|z|j|t)?([diouxXcsp%])")
+
+
+class Image:
+    """Loaded sections of the ELF, to read strings by address."""
+
+    def __init__(self, path):
+        from elftools.elf.elffile import ELFFile
+
+        self.sections = []
+        with open(path, "rb") as elf_file:
+            elf = ELFFile(elf_file)
+            for section in elf.iter_sections():
+                if section["sh_addr"] and section["sh_type"] == "SHT_PROGBITS":
+                    self.sections.append((section["sh_addr"], section.data()))
+
+    def string(self, address):
+        for start, data in self.sections:
+            if start <= address < start + len(data):
+                end = data.find(b"\0", address - start)
+                if end < 0:
+                    end = len(data)
+                return data[address - start:end].decode(errors="replace")
+        return None
+
+
+def strip_itm(data):
+    """Payload of the software source packets of stimulus port 0."""
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        header = data[i]
+        i += 1
+        if header & 0x03:
+            size = (0, 1, 2, 4)[header & 0x03]
+            if not header & 0x04 and header >> 3 == 0:
+                out += data[i:i + size]
+            i += size
+        elif header & 0x80:
+            # Timestamp or extension packet: skip the continuation bytes
+            while i < len(data) and data[i] & 0x80:
+                i += 1
+            i += 1
+    return bytes(out)
+
+
+def format_message(image, fmt, args):
+    args = list(args)
+
+    def convert(match):
+        kind = match.group(1)
+        if kind == "%":
+            return "%"
+        if not args:
+            return match.group(0)
+        value = args.pop(0)
+        if kind == "s":
+            text = image.string(value)
+            return text if text is not None else "<0x%08x>" % value
+        if kind == "p":
+            return "0x%08x" % value
+        if kind in "di":
+            value = struct.unpack("<i", struct.pack("<I", value))[0]
+        spec = match.group(0)
+        spec = re.sub(r"(hh|h|ll|l|z|j|t)(?=[a-zA-Z%]$)", "", spec)
+        return spec % value
+
+    return CONVERSION.sub(convert, fmt)
+
+
+def decode(image, data):
+    i = 0
+    high = 0
+    last = 0
+    while i + 9 <= len(data):
+        if data[i] != SYNC:
+            i += 1
+            continue
+        info, address = struct.unpack_from("<II", data, i + 1)
+        nargs = info & 0xF
+        level = (info >> 4) & 0xF
+        fmt = image.string(address) if address else ""
+        if nargs > MAX_ARGS or level not in LEVELS or fmt is None \
+                or i + 9 + 4 * nargs > len(data):
+            # Not a record: console text, or a corrupted record
+            i += 1
+            continue
+        args = struct.unpack_from("<%dI" % nargs, data, i + 9)
+        i += 9 + 4 * nargs
+
+        # The time is 24-bit on the target
+        ms = info >> 8
+        if ms < last:
+            high += 1 << 24
+        last = ms
+        ms += high
+
+        if address == 0:
+            text = "%d message(s) dropped, ring full" % args[0]
+            level = 2
+        else:
+            text = format_message(image, fmt, args)
+        yield "[%s]\t(%d.%03d)\t%s" % (LEVELS[level], ms // 1000, ms % 1000, text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", help="captured SWO stream, - for stdin")
+    parser.add_argument("--elf", required=True, help="ELF of the running firmware")
+    parser.add_argument("--itm", action="store_true", help="the input is in ITM packets")
+    args = parser.parse_args()
+
+    if args.input == "-":
+        data = sys.stdin.buffer.read()
+    else:
+        with open(args.input, "rb") as source:
+            data = source.read()
+    if args.itm:
+        data = strip_itm(data)
+
+    for line in decode(Image(args.elf), data):
+        print(line)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,218 @@
+#!/usr/bin/env python3
+# Copyright (c) 2021, CATIE
+# SPDX-License-Identifier: Apache-2.0
+"""Sweep lv_conf.h and mbed_app.json settings, and list the frame time / RAM Pareto front.
+
+Each point of the matrix is built with its own application config (the lv_conf.h
+settings as macros, the mbed_app.json ones as config values, plus benchmark and
+mem-report), in parallel on all the host cores. Each build is then flashed and
+its "BENCH {...}" and "MEM {...}" lines read from the console, one at a time.
+
+The frame time of a point is the mean render + flush time of the benchmark
+screens, the flush time running until the pixels are on the panel. The benchmark
+refreshes with lv_refr_now() and draws the logo without an image decoder, so
+LV_DISP_DEF_REFR_PERIOD and LV_IMG_CACHE_DEF_SIZE are not swept: they would not
+change the frame time. The RAM is the static RAM
+of the linker map (the LVGL heap, the draw buffers and the shadow cache are all
+static). Points that crash or miss the console lines are reported as failed.
+
+Usage:
+    config_sweep.py --port /dev/ttyUSB0
+    config_sweep.py --set LV_MEM_SIZE=24576,32768 --set draw-buf-rows=5,10,20 --port /dev/ttyUSB0
+    config_sweep.py --no-run --output sweep.json
+"""
+
+import argparse
+import concurrent.futures
+import glob
+import itertools
+import json
+import os
+import shlex
+import subprocess
+import sys
+import time
+
+from mem_report import memories, read_map
+
+TARGET = "ZEST_CORE_STM32L4A6RG"
+TOOLCHAIN = "GCC_ARM"
+BENCH_PREFIX = "BENCH "
+MEM_PREFIX = "MEM "
+
+# lv_conf.h settings (upper case, passed as macros) and mbed_app.json ones
+PARAMETERS = {
+    "LV_MEM_SIZE": (24576, 32768, 49152),
+    "LV_SHADOW_CACHE_SIZE": (0, 32),
+    "draw-buf-rows": (5, 10, 20),
+}
+
+
+def parse_set(text):
+    name, _, values = text.partition("=")
+    if not values:
+        raise argparse.ArgumentTypeError("expected NAME=VALUE[,VALUE...]: %s" % text)
+    return name, tuple(int(value, 0) for value in values.split(","))
+
+
+def points(parameters):
+    names = sorted(parameters)
+    for values in itertools.product(*(parameters[name] for name in names)):
+        yield dict(zip(names, values))
+
+
+def point_name(point):
+    return "_".join("%s%d" % (name.lower().replace("lv_", "").replace("-", "_")[:8], value)
+                    for name, value in sorted(point.items()))
+
+
+def write_app_config(point, path):
+    with open("mbed_app.json") as app_file:
+        app = json.load(app_file)
+    overrides = app.setdefault("target_overrides", {}).setdefault("*", {})
+    overrides["app.benchmark"] = 1
+    overrides["app.mem-report"] = 1
+    macros = app.setdefault("macros", [])
+    for name, value in point.items():
+        if name.isupper():
+            macros.append("%s=%d" % (name, value))
+        else:
+            overrides["app." + name] = value
+    with open(path, "w") as app_file:
+        json.dump(app, app_file, indent=4)
+
+
+def build(point, build_root):
+    """Build one point, return its ELF and map, or None when it does not build."""
+    build_dir = os.path.join(build_root, point_name(point))
+    os.makedirs(build_dir, exist_ok=True)
+    app_config = os.path.join(build_dir, "mbed_app.json")
+    write_app_config(point, app_config)
+    command = ["mbed", "compile", "-m", TARGET, "-t", TOOLCHAIN, "-j", "1",
+               "--app-config", app_config, "--build", build_dir]
+    with open(os.path.join(build_dir, "build.log"), "w") as log:
+        status = subprocess.call(command, stdout=log, stderr=subprocess.STDOUT)
+    elf = glob.glob(os.path.join(build_dir, "*.elf"))
+    maps = glob.glob(os.path.join(build_dir, "*.map"))
+    if status or not elf or not maps:
+        return None
+    return elf[0], maps[0]
+
+
+def static_ram(map_path):
+    return sum(size for section, size, _ in read_map(map_path) if "ram" in memories(section))
+
+
+def run(elf, args):
+    """Flash one build, return its BENCH and MEM results, or None."""
+    import serial
+
+    port = serial.Serial(args.port, args.baudrate, timeout=1)
+    port.reset_input_buffer()
+    if subprocess.call(shlex.split(args.flash.format(elf=elf))):
+        port.close()
+        return None
+    results = {}
+    deadline = time.monotonic() + args.timeout
+    while time.monotonic() < deadline and len(results) < 2:
+        line = port.readline().decode(errors="replace")
+        for key, prefix in (("bench", BENCH_PREFIX), ("mem", MEM_PREFIX)):
+            if line.startswith(prefix):
+                results[key] = json.loads(line[len(prefix):])
+    port.close()
+    return results if len(results) == 2 else None
+
+
+def frame_us(bench):
+    screens = bench["screens"]
+    return int(sum(s["render_us"] + s["flush_us"] for s in screens) / len(screens))
+
+
+def pareto(results):
+    """Mark the points that no other point beats on both frame time and RAM."""
+    measured = [r for r in results if r.get("frame_us") is not None]
+    for result in measured:
+        result["pareto"] = not any(
+            other["frame_us"] <= result["frame_us"] and other["ram"] <= result["ram"]
+            and (other["frame_us"], other["ram"]) != (result["frame_us"], result["ram"])
+            for other in measured)
+
+
+def print_table(results, names):
+    header = ["", "frame_us", "ram", "heap_max"] + names
+    rows = []
+    for r in sorted(results, key=lambda r: (r.get("frame_us") is None,
+                                            r.get("frame_us") or 0, r.get("ram") or 0)):
+        status = "*" if r.get("pareto") else ("FAIL" if r.get("failed") else "")
+        rows.append([status,
+                     "-" if r.get("frame_us") is None else str(r["frame_us"]),
+                     "-" if r.get("ram") is None else str(r["ram"]),
+                     "-" if r.get("heap_max") is None else str(r["heap_max"])]
+                    + [str(r["point"][name]) for name in names])
+    widths = [max(len(row[i]) for row in [header] + rows) for i in range(len(header))]
+    for row in [header] + rows:
+        print("  ".join(cell.rjust(width) for cell, width in zip(row, widths)))
+    print("\n* Pareto front: no other point has both a lower frame time and less RAM")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--set", type=parse_set, action="append", default=[],
+                        metavar="NAME=V1,V2", help="values swept for a setting, "
+                        "replaces its default values (repeatable)")
+    parser.add_argument("--only", action="store_true",
+                        help="sweep only the --set settings, keep the others as configured")
+    parser.add_argument("--jobs", type=int, default=os.cpu_count(),
+                        help="parallel builds (default: all the host cores)")
+    parser.add_argument("--build", default="BUILD/sweep", help="root of the sweep builds")
+    parser.add_argument("--no-run", action="store_true",
+                        help="only build and report the static RAM")
+    parser.add_argument("--port", help="serial port of the target console")
+    parser.add_argument("--baudrate", type=int, default=9600)
+    parser.add_argument("--timeout", type=float, default=60,
+                        help="seconds to wait for the results of a build")
+    parser.add_argument("--flash", default="python dist/program.py STM32L4A6RG {elf}",
+                        help="command that programs {elf} on the target")
+    parser.add_argument("--output", help="write the results to this JSON file")
+    args = parser.parse_args()
+    if not args.no_run and not args.port:
+        parser.error("--port is required, unless --no-run")
+
+    parameters = {} if args.only else dict(PARAMETERS)
+    parameters.update(args.set)
+    names = sorted(parameters)
+    matrix = list(points(parameters))
+    print("%d configurations, %d parallel builds" % (len(matrix), args.jobs))
+
+    results = [{"point": point} for point in matrix]
+    with concurrent.futures.ThreadPoolExecutor(max_workers=args.jobs) as pool:
+        builds = list(pool.map(lambda point: build(point, args.build), matrix))
+
+    for result, built in zip(results, builds):
+        if not built:
+            print("%s: build failed" % point_name(result["point"]))
+            result["failed"] = "build"
+            continue
+        elf, map_path = built
+        result["ram"] = static_ram(map_path)
+        if args.no_run:
+            continue
+        print("%s: running" % point_name(result["point"]))
+        output = run(elf, args)
+        if not output:
+            result["failed"] = "run"
+            continue
+        result["frame_us"] = frame_us(output["bench"])
+        result["heap_max"] = output["mem"]["lv_max_used"]
+
+    pareto(results)
+    print()
+    print_table(results, names)
+    if args.output:
+        with open(args.output, "w") as output:
+            json.dump(results, output, indent=4)
+            output.write("\n")
+
+
+if __name__ == "__main__":
+    main()
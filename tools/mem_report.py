@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+# Copyright (c) 2021, CATIE
+# SPDX-License-Identifier: Apache-2.0
+"""RAM and flash footprint per subsystem, checked against budgets.
+
+Reads the GCC_ARM linker map of a build and, optionally, the "MEM {...}" line
+printed by a mem-report build (lv_mem_monitor() of the LVGL heap). Prints the
+flash and RAM used by each subsystem and the largest RAM sections, and exits
+with an error when a budget of the budget file is exceeded.
+
+Usage:
+    mem_report.py --map BUILD/ZEST_CORE_STM32L4A6RG/GCC_ARM/zest-display-lcd-demo.map
+    mem_report.py --map app.map --budget tools/mem_budget.json --log console.log
+"""
+
+import argparse
+import json
+import re
+import sys
+
+MEM_PREFIX = "MEM "
+
+# Input section name prefixes, and the memories they take
+FLASH_SECTIONS = (".text", ".rodata", ".ARM.exidx", ".ARM.extab", ".isr_vector",
+                  ".init", ".fini", ".ctors", ".dtors", ".init_array", ".fini_array")
+FLASH_RAM_SECTIONS = (".data", ".fast_code")
+RAM_SECTIONS = (".bss", "COMMON", ".noinit")
+
+SINGLE_LINE = re.compile(r"^ (\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$")
+NAME_LINE = re.compile(r"^ (\S+)$")
+VALUE_LINE = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$")
+
+
+def memories(section):
+    if section.startswith(FLASH_RAM_SECTIONS):
+        return ("flash", "ram")
+    if section.startswith(FLASH_SECTIONS):
+        return ("flash",)
+    if section.startswith(RAM_SECTIONS):
+        return ("ram",)
+    return ()
+
+
+def read_map(path):
+    """Return the (section, size, object) input sections of a map file."""
+    sections = []
+    pending = None
+    in_map = False
+    with open(path, errors="replace") as map_file:
+        for line in map_file:
+            line = line.rstrip("\n")
+            if not in_map:
+                in_map = line.startswith("Linker script and memory map")
+                continue
+            match = SINGLE_LINE.match(line)
+            if match:
+                name, _, size, obj = match.groups()
+                sections.append((name, int(size, 16), obj))
+                pending = None
+                continue
+            match = NAME_LINE.match(line)
+            if match:
+                pending = match.group(1)
+                continue
+            match = VALUE_LINE.match(line)
+            if match and pending:
+                _, size, obj = match.groups()
+                sections.append((pending, int(size, 16), obj))
+            pending = None
+    if not in_map:
+        sys.exit("%s: no memory map found" % path)
+    return sections
+
+
+def subsystem_of(obj, subsystems):
+    path = obj.replace("\\", "/")
+    for name, patterns in subsystems:
+        if any(pattern in path for pattern in patterns):
+            return name
+    return "other"
+
+
+def read_mem_line(path):
+    with open(path, errors="replace") as log:
+        for line in log:
+            if line.startswith(MEM_PREFIX):
+                return json.loads(line[len(MEM_PREFIX):])
+    sys.exit("no MEM line found in %s" % path)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--map", required=True, help="GCC_ARM linker map file")
+    parser.add_argument("--budget", default="tools/mem_budget.json",
+                        help="subsystems and budgets (default: tools/mem_budget.json)")
+    parser.add_argument("--log", help="console log of a mem-report build")
+    parser.add_argument("--top", type=int, default=10, help="largest RAM sections listed")
+    args = parser.parse_args()
+
+    with open(args.budget) as budget_file:
+        config = json.load(budget_file)
+    subsystems = [(entry["name"], entry["patterns"]) for entry in config["subsystems"]]
+    budgets = config.get("budgets", {})
+
+    usage = {}
+    ram_sections = []
+    for section, size, obj in read_map(args.map):
+        used = memories(section)
+        if not size or not used:
+            continue
+        name = subsystem_of(obj, subsystems)
+        for memory in used:
+            for key in (name, "total"):
+                usage.setdefault(key, {"flash": 0, "ram": 0})[memory] += size
+        if "ram" in used:
+            ram_sections.append((size, section, obj))
+
+    failures = []
+
+    def check(name, memory, value):
+        budget = budgets.get(name, {}).get(memory)
+        text = "%10d" % budget if budget is not None else "%10s" % "-"
+        if budget is not None and value > budget:
+            failures.append("%s %s: %d bytes, budget %d" % (name, memory, value, budget))
+            text += " OVER"
+        return text
+
+    print("%-12s %10s %10s %10s %10s" % ("subsystem", "flash", "budget", "ram", "budget"))
+    names = [name for name, _ in subsystems] + ["other", "total"]
+    for name in names:
+        if name not in usage:
+            continue
+        flash, ram = usage[name]["flash"], usage[name]["ram"]
+        print("%-12s %10d %s %10d %s" % (name, flash, check(name, "flash", flash),
+                                         ram, check(name, "ram", ram)))
+
+    print("\nlargest RAM sections:")
+    for size, section, obj in sorted(ram_sections, reverse=True)[:args.top]:
+        print("%10d  %-40s %s" % (size, section, obj))
+
+    if args.log:
+        heap = read_mem_line(args.log)
+        print("\nLVGL heap: %d bytes, %d max used, %d%% fragmented"
+              % (heap["lv_total"], heap["lv_max_used"], heap["lv_frag_pct"]))
+        check("lvgl_heap", "max_used", heap["lv_max_used"])
+
+    for failure in failures:
+        print("FAIL " + failure)
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+# Copyright (c) 2021, CATIE
+# SPDX-License-Identifier: Apache-2.0
+"""Viewer for the screen mirror of the Zest Display LCD demo.
+
+Reassembles the areas sent by ScreenMirror (screen_mirror.h) into a frame and
+shows it in a window. The viewer sends a heartbeat so that the target only
+mirrors its display while the viewer runs.
+
+Usage: mirror_viewer.py /dev/ttyUSB0 [--baudrate 921600] [--scale 3]
+"""
+
+import argparse
+import struct
+import threading
+import time
+import tkinter as tk
+
+import serial
+
+WIDTH = 128
+HEIGHT = 160
+HEARTBEAT = b"M"
+HEARTBEAT_PERIOD = 0.5
+
+
+def rgb565_to_rgb(pixel):
+    r = (pixel >> 11) & 0x1F
+    g = (pixel >> 5) & 0x3F
+    b = pixel & 0x1F
+    return bytes(((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)))
+
+
+class Decoder:
+    """Parses the mirror stream and updates an RGB888 frame."""
+
+    def __init__(self, port):
+        self.port = port
+        self.frame = bytearray(WIDTH * HEIGHT * 3)
+        self.lock = threading.Lock()
+        self.dirty = True
+        self.packets = 0
+
+    def read(self, size):
+        data = self.port.read(size)
+        while len(data) < size:
+            data += self.port.read(size - len(data))
+        return data
+
+    def sync(self):
+        previous = b""
+        while True:
+            byte = self.read(1)
+            if previous == b"L" and byte == b"V":
+                return
+            previous = byte
+
+    def run(self):
+        while True:
+            self.sync()
+            x1, y1, x2, y2 = struct.unpack("<4H", self.read(8))
+            if x1 > x2 or y1 > y2 or x2 >= WIDTH or y2 >= HEIGHT:
+                continue
+            self.decode_area(x1, y1, x2, y2)
+
+    def decode_area(self, x1, y1, x2, y2):
+        w = x2 - x1 + 1
+        count = w * (y2 - y1 + 1)
+        pixels = []
+        while len(pixels) < count:
+            token = self.read(1)[0]
+            n = (token & 0x7F) + 1
+            if token & 0x80:
+                pixels.extend([struct.unpack("<H", self.read(2))[0]] * n)
+            else:
+                pixels.extend(struct.unpack("<%dH" % n, self.read(2 * n)))
+        with self.lock:
+            for i, pixel in enumerate(pixels[:count]):
+                offset = ((y1 + i // w) * WIDTH + x1 + i % w) * 3
+                self.frame[offset:offset + 3] = rgb565_to_rgb(pixel)
+            self.dirty = True
+            self.packets += 1
+
+
+def heartbeat(port):
+    while True:
+        port.write(HEARTBEAT)
+        time.sleep(HEARTBEAT_PERIOD)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("port", help="serial port connected to the mirror UART")
+    parser.add_argument("--baudrate", type=int, default=921600)
+    parser.add_argument("--scale", type=int, default=3)
+    args = parser.parse_args()
+
+    port = serial.Serial(args.port, args.baudrate, timeout=1)
+    decoder = Decoder(port)
+    threading.Thread(target=heartbeat, args=(port,), daemon=True).start()
+    threading.Thread(target=decoder.run, daemon=True).start()
+
+    root = tk.Tk()
+    root.title("Zest Display LCD mirror")
+    label = tk.Label(root)
+    label.pack()
+
+    def refresh():
+        with decoder.lock:
+            if decoder.dirty:
+                header = b"P6 %d %d 255\n" % (WIDTH, HEIGHT)
+                image = tk.PhotoImage(data=header + bytes(decoder.frame), format="PPM")
+                image = image.zoom(args.scale)
+                label.configure(image=image)
+                label.image = image
+                root.title("Zest Display LCD mirror - %d areas" % decoder.packets)
+                decoder.dirty = False
+        root.after(50, refresh)
+
+    refresh()
+    root.mainloop()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+# Copyright (c) 2021, CATIE
+# SPDX-License-Identifier: Apache-2.0
+"""Convert an image to an LVGL indexed (palette) C array, for palette_image.h.
+
+The colors are quantized by median cut to a 1, 2, 4 or 8-bit palette. With
+--bpp auto, the smallest depth whose PSNR against the source reaches
+--min-psnr is kept. The output is a header holding the palette (LVGL
+lv_color32_t entries) followed by the byte-aligned rows of indices, most
+significant pixel first, as expected by LV_IMG_CF_INDEXED_<n>BIT.
+
+Usage:
+    palette_convert.py sixtron-logo1.h --width 118 --height 150 --name logo_indexed -o sixtron-logo-indexed.h
+    palette_convert.py logo.png --bpp 4 -o logo.h
+"""
+
+import argparse
+import math
+
+from rli_convert import load_c_array, load_image
+
+DEPTHS = (1, 2, 4, 8)
+
+
+def to_rgb(color):
+    r, g, b = (color >> 11) & 0x1F, (color >> 5) & 0x3F, color & 0x1F
+    return ((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2))
+
+
+def median_cut(histogram, count):
+    """Split the box of colors with the widest channel until count boxes."""
+    boxes = [list(histogram.items())]
+    while len(boxes) < count:
+        splittable = [box for box in boxes if len(box) > 1]
+        if not splittable:
+            break
+        box = max(splittable, key=lambda b: max(
+            max(to_rgb(c)[ch] for c, _ in b) - min(to_rgb(c)[ch] for c, _ in b)
+            for ch in range(3)))
+        channel = max(range(3), key=lambda ch: max(to_rgb(c)[ch] for c, _ in box)
+                      - min(to_rgb(c)[ch] for c, _ in box))
+        box.sort(key=lambda item: to_rgb(item[0])[channel])
+        # Split at the median pixel, not the median color
+        total = sum(n for _, n in box)
+        seen = 0
+        for split, (_, n) in enumerate(box):
+            seen += n
+            if seen * 2 >= total:
+                break
+        split = min(max(split + 1, 1), len(box) - 1)
+        boxes.remove(box)
+        boxes += [box[:split], box[split:]]
+
+    palette = []
+    for box in boxes:
+        total = sum(n for _, n in box)
+        palette.append(tuple(
+            round(sum(to_rgb(c)[ch] * n for c, n in box) / total) for ch in range(3)))
+    return palette
+
+
+def quantize(rows, bpp):
+    histogram = {}
+    for row in rows:
+        for color in row:
+            histogram[color] = histogram.get(color, 0) + 1
+    palette = median_cut(histogram, 1 << bpp)
+
+    nearest = {}
+    for color in histogram:
+        rgb = to_rgb(color)
+        nearest[color] = min(range(len(palette)), key=lambda i: sum(
+            (palette[i][ch] - rgb[ch]) ** 2 for ch in range(3)))
+
+    error = 0
+    for color, n in histogram.items():
+        rgb = to_rgb(color)
+        error += n * sum((palette[nearest[color]][ch] - rgb[ch]) ** 2 for ch in range(3))
+    mse = error / (3.0 * len(rows) * len(rows[0]))
+    psnr = 10 * math.log10(255 * 255 / mse) if mse else float("inf")
+
+    indices = [[nearest[color] for color in row] for row in rows]
+    return palette, indices, psnr
+
+
+def pack(palette, indices, bpp):
+    data = bytearray()
+    for i in range(1 << bpp):
+        r, g, b = palette[i] if i < len(palette) else (0, 0, 0)
+        data += bytes((b, g, r, 0xFF))
+    per_byte = 8 // bpp
+    for row in indices:
+        for x in range(0, len(row), per_byte):
+            byte = 0
+            for i, index in enumerate(row[x:x + per_byte]):
+                byte |= index << (8 - bpp * (i + 1))
+            data.append(byte)
+    return data
+
+
+def write_header(path, name, data, width, height, bpp):
+    with open(path, "w") as out:
+        out.write("/* %dx%d, %d-bit palette, made by tools/palette_convert.py */\n"
+                  % (width, height, bpp))
+        out.write("#define %s_WIDTH %d\n" % (name.upper(), width))
+        out.write("#define %s_HEIGHT %d\n" % (name.upper(), height))
+        out.write("#define %s_CF LV_IMG_CF_INDEXED_%dBIT\n\n" % (name.upper(), bpp))
+        out.write("const uint8_t %s_data[%d] = {\n" % (name, len(data)))
+        for i in range(0, len(data), 16):
+            out.write("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",\n")
+        out.write("};\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("source", help="C array (.h, .c) or image file")
+    parser.add_argument("--width", type=int, help="width of a C array source")
+    parser.add_argument("--height", type=int, help="height of a C array source")
+    parser.add_argument("--bpp", default="auto", choices=["auto"] + [str(d) for d in DEPTHS])
+    parser.add_argument("--min-psnr", type=float, default=35.0,
+                        help="quality kept by --bpp auto, in dB (default: 35)")
+    parser.add_argument("--name", default="image_indexed", help="name of the C array")
+    parser.add_argument("-o", "--output", required=True)
+    args = parser.parse_args()
+
+    if args.source.endswith((".h", ".c")):
+        if not args.width or not args.height:
+            parser.error("--width and --height are required for a C array")
+        rows = load_c_array(args.source, args.width, args.height)
+    else:
+        rows = load_image(args.source)
+
+    depths = DEPTHS if args.bpp == "auto" else (int(args.bpp),)
+    for bpp in depths:
+        palette, indices, psnr = quantize(rows, bpp)
+        print("%d-bit: PSNR %.1f dB" % (bpp, psnr))
+        if psnr >= args.min_psnr or bpp == depths[-1]:
+            break
+
+    data = pack(palette, indices, bpp)
+    width, height = len(rows[0]), len(rows)
+    write_header(args.output, args.name, data, width, height, bpp)
+    raw = 2 * width * height
+    print("%s: %d-bit, %d bytes (raw RGB565: %d bytes, %.0f%%)"
+          % (args.output, bpp, len(data), raw, 100.0 * len(data) / raw))
+
+
+if __name__ == "__main__":
+    main()
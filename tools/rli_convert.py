@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+# Copyright (c) 2021, CATIE
+# SPDX-License-Identifier: Apache-2.0
+"""Convert an image to the run-length encoded RGB565 format of rle_image.h.
+
+The source is either a C array of RGB565 values, such as sixtron-logo1.h, or
+any image file readable by Pillow.
+
+Usage:
+    rli_convert.py sixtron-logo1.h --width 118 --height 150 -o logo.rli
+    rli_convert.py logo.png -o logo.rli
+"""
+
+import argparse
+import re
+import struct
+
+MAX_TOKEN = 128
+
+
+def load_c_array(path, width, height):
+    with open(path) as source:
+        body = source.read().split("{", 1)[1].split("}", 1)[0]
+    values = [int(value, 0) for value in re.findall(r"0x[0-9a-fA-F]+|\d+", body)]
+    if len(values) < width * height:
+        raise SystemExit("%s holds %d pixels, %dx%d expected" % (path, len(values), width, height))
+    return [values[y * width:(y + 1) * width] for y in range(height)]
+
+
+def load_image(path):
+    from PIL import Image
+
+    image = Image.open(path).convert("RGB")
+    width, height = image.size
+    pixels = list(image.getdata())
+    rows = []
+    for y in range(height):
+        row = []
+        for r, g, b in pixels[y * width:(y + 1) * width]:
+            row.append(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3))
+        rows.append(row)
+    return rows
+
+
+def encode_row(row):
+    out = bytearray()
+    i = 0
+    while i < len(row):
+        n = 1
+        while i + n < len(row) and n < MAX_TOKEN and row[i + n] == row[i]:
+            n += 1
+        if n > 1:
+            out += struct.pack("<BH", 0x80 | (n - 1), row[i])
+            i += n
+            continue
+        # Literals stop where a run starts
+        while (i + n < len(row) and n < MAX_TOKEN
+               and not (i + n + 1 < len(row) and row[i + n] == row[i + n + 1])):
+            n += 1
+        out += struct.pack("<B%dH" % n, n - 1, *row[i:i + n])
+        i += n
+    return out
+
+
+def encode(rows):
+    width, height = len(rows[0]), len(rows)
+    packed = [encode_row(row) for row in rows]
+    offset = 8 + 4 * (height + 1)
+    offsets = []
+    for row in packed:
+        offsets.append(offset)
+        offset += len(row)
+    offsets.append(offset)
+    return (b"RLI1" + struct.pack("<HH", width, height)
+            + struct.pack("<%dI" % len(offsets), *offsets) + b"".join(packed))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("source", help="C array (.h, .c) or image file")
+    parser.add_argument("--width", type=int, help="width of a C array source")
+    parser.add_argument("--height", type=int, help="height of a C array source")
+    parser.add_argument("-o", "--output", required=True)
+    args = parser.parse_args()
+
+    if args.source.endswith((".h", ".c")):
+        if not args.width or not args.height:
+            parser.error("--width and --height are required for a C array")
+        rows = load_c_array(args.source, args.width, args.height)
+    else:
+        rows = load_image(args.source)
+
+    data = encode(rows)
+    with open(args.output, "wb") as output:
+        output.write(data)
+    raw = 2 * len(rows) * len(rows[0])
+    print("%s: %d bytes (raw RGB565: %d bytes, %.0f%%)"
+          % (args.output, len(data), raw, 100.0 * len(data) / raw))
+
+
+if __name__ == "__main__":
+    main()
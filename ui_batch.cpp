@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include "ui_batch.h"
+
+static Mutex lvgl_mutex;
+
+void ui_lock()
+{
+    lvgl_mutex.lock();
+}
+
+void ui_unlock()
+{
+    lvgl_mutex.unlock();
+}
+
+UiBatch::UiBatch(lv_disp_t *disp):
+    _disp(disp),
+    _count(0),
+    _text_used(0)
+{
+}
+
+void UiBatch::begin_update()
+{
+    _count = 0;
+    _text_used = 0;
+}
+
+bool UiBatch::set_text(lv_obj_t *label, const char *text)
+{
+    size_t len = strlen(text) + 1;
+
+    if (_count == UI_BATCH_MAX_CHANGES || _text_used + len > sizeof(_text)) {
+        return false;
+    }
+
+    memcpy(&_text[_text_used], text, len);
+    _changes[_count++] = {Kind::Text, label, (int32_t)_text_used, nullptr};
+    _text_used += len;
+
+    return true;
+}
+
+bool UiBatch::set_value(lv_obj_t *obj, int32_t value)
+{
+    if (_count == UI_BATCH_MAX_CHANGES) {
+        return false;
+    }
+
+    _changes[_count++] = {Kind::Value, obj, value, nullptr};
+
+    return true;
+}
+
+bool UiBatch::call(mbed::Callback<void()> change)
+{
+    if (_count == UI_BATCH_MAX_CHANGES) {
+        return false;
+    }
+
+    _changes[_count++] = {Kind::Call, nullptr, 0, change};
+
+    return true;
+}
+
+size_t UiBatch::commit()
+{
+    size_t count = _count;
+
+    ui_lock();
+    for (size_t i = 0; i < count; i++) {
+        Change &change = _changes[i];
+        switch (change.kind) {
+            case Kind::Text:
+                lv_label_set_text(change.obj, &_text[change.value]);
+                break;
+            case Kind::Value:
+                if (lv_obj_check_type(change.obj, &lv_slider_class)) {
+                    lv_slider_set_value(change.obj, change.value, LV_ANIM_OFF);
+                } else if (lv_obj_check_type(change.obj, &lv_bar_class)) {
+                    lv_bar_set_value(change.obj, change.value, LV_ANIM_OFF);
+                } else if (lv_obj_check_type(change.obj, &lv_arc_class)) {
+                    lv_arc_set_value(change.obj, change.value);
+                }
+                break;
+            case Kind::Call:
+                change.call();
+                break;
+        }
+    }
+
+    /* One refresh pass for all the invalidated areas */
+    lv_refr_now(_disp);
+    ui_unlock();
+
+    begin_update();
+
+    return count;
+}
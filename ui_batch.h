@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2021, CATIE
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef UI_BATCH_H
+#define UI_BATCH_H
+
+#include "mbed.h"
+#include "lvgl.h"
+
+/* Changes per batch */
+#ifndef UI_BATCH_MAX_CHANGES
+#define UI_BATCH_MAX_CHANGES 16
+#endif
+
+/* Bytes of label text per batch, terminators included */
+#ifndef UI_BATCH_TEXT_SIZE
+#define UI_BATCH_TEXT_SIZE 256
+#endif
+
+/* LVGL is not thread safe: any LVGL call outside of the main loop is done
+ * between ui_lock() and ui_unlock() */
+void ui_lock();
+void ui_unlock();
+
+/**
+ * Widget updates from an application thread, applied as one frame.
+ *
+ * The changes are queued by begin_update() and the setters, without LVGL.
+ * commit() then takes the LVGL lock once, applies them, and refreshes the
+ * display in one pass: the invalidated areas of all the widgets are joined
+ * by LVGL, so ten labels updated from one sensor packet cost one frame.
+ *
+ * A batch belongs to one thread.
+ */
+class UiBatch {
+public:
+    UiBatch(lv_disp_t *disp = nullptr);
+
+    /* Start a new batch, the changes not committed are dropped */
+    void begin_update();
+
+    /* Queue a label text, copied. Return false when the batch is full */
+    bool set_text(lv_obj_t *label, const char *text);
+
+    /* Queue the value of a bar, slider or arc */
+    bool set_value(lv_obj_t *obj, int32_t value);
+
+    /* Queue any other change, run under the LVGL lock */
+    bool call(mbed::Callback<void()> change);
+
+    /* Apply the changes and refresh the display. Return the number of
+     * changes applied */
+    size_t commit();
+
+private:
+    enum class Kind : uint8_t {
+        Text,
+        Value,
+        Call,
+    };
+
+    struct Change {
+        Kind kind;
+        lv_obj_t *obj;
+        int32_t value; /* or offset of the text */
+        mbed::Callback<void()> call;
+    };
+
+    lv_disp_t *_disp;
+    Change _changes[UI_BATCH_MAX_CHANGES];
+    size_t _count;
+    char _text[UI_BATCH_TEXT_SIZE];
+    size_t _text_used;
+};
+
+#endif // UI_BATCH_H